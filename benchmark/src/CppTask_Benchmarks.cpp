@@ -0,0 +1,473 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// STL
+#include <array>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// External
+#include <benchmark/benchmark.h>
+
+// Project
+#include "../../include/libcpptask/CppTask_Pool.h"
+#include "../../include/libcpptask/CppTask_Schedule.h"
+#include "../../include/libcpptask/CppTask_Task.h"
+#include "../../include/libcpptask/CppTask_TaskAllocator.h"
+#include "../../include/libcpptask/CppTask_TaskGroup.h"
+#include "../../include/libcpptask/CppTask_WorkerLocal.h"
+
+
+//******************************************************************************
+// MARK: Helpers
+//******************************************************************************
+
+/**
+ *  @brief Get a pool with a thread count, shared by all benchmarks. Creating
+ *         threads is not part of any measurement.
+ *
+ *  @param threadCount The number of pool threads.
+ *
+ *  @returns The pool.
+ */
+static CppTask::Pool&
+GetPool(size_t threadCount)
+{
+    static std::mutex s_mutex;
+    static std::map<size_t, std::unique_ptr<CppTask::Pool>> s_pools;
+
+    std::lock_guard<std::mutex> lockGuard(s_mutex);
+    auto& rpPool = s_pools[threadCount];
+
+    if (!rpPool)
+    {
+        CppTask::PoolOptions options;
+        options.m_threadCount = threadCount;
+
+        rpPool = std::make_unique<CppTask::Pool>(options);
+    }
+
+    return *rpPool;
+}
+
+/**
+ *  @brief Add the thread counts to run a benchmark with, up to the hardware
+ *         thread count.
+ *
+ *  @param pBenchmark The benchmark.
+ */
+static void
+ThreadCounts(benchmark::internal::Benchmark* pBenchmark)
+{
+    auto maxThreadCount = std::max<unsigned>(std::thread::hardware_concurrency(), 1);
+
+    for (unsigned threadCount = 1; threadCount < maxThreadCount; threadCount *= 2)
+    {
+        pBenchmark->Arg(threadCount);
+    }
+
+    pBenchmark->Arg(maxThreadCount);
+}
+
+//******************************************************************************
+// MARK: Task Lifetime
+//******************************************************************************
+
+/**
+ *  @brief The cost of creating and destroying a task which never runs.
+ */
+static void
+BM_Task_ConstructDestroy(benchmark::State& rState)
+{
+    for (auto _ : rState)
+    {
+        CppTask::Task<int> task([](){
+            return 1;
+        });
+
+        benchmark::DoNotOptimize(task);
+    }
+}
+BENCHMARK(BM_Task_ConstructDestroy);
+
+/**
+ *  @brief The cost of creating and destroying a task allocated from the 
+ *         thread cache.
+ */
+static void
+BM_Task_ConstructDestroyThreadCache(benchmark::State& rState)
+{
+    CppTask::TaskAllocator::SetMemoryResource(CppTask::TaskAllocator::ThreadCache());
+
+    for (auto _ : rState)
+    {
+        CppTask::Task<int> task([](){
+            return 1;
+        });
+
+        benchmark::DoNotOptimize(task);
+    }
+
+    CppTask::TaskAllocator::SetMemoryResource(nullptr);
+}
+BENCHMARK(BM_Task_ConstructDestroyThreadCache);
+
+/**
+ *  @brief The cost of creating and destroying a task with a capture too 
+ *         large to be stored inside the task.
+ */
+static void
+BM_Task_ConstructDestroyLargeCapture(benchmark::State& rState)
+{
+    std::array<char, 128> buffer {};
+
+    for (auto _ : rState)
+    {
+        CppTask::Task<size_t> task([buffer](){
+            return buffer.size();
+        });
+
+        benchmark::DoNotOptimize(task);
+    }
+}
+BENCHMARK(BM_Task_ConstructDestroyLargeCapture);
+
+/**
+ *  @brief The cost of creating, running on the calling thread and destroying
+ *         a task.
+ */
+static void
+BM_Task_Run(benchmark::State& rState)
+{
+    for (auto _ : rState)
+    {
+        CppTask::Task<int> task([](){
+            return 1;
+        });
+
+        task.Run();
+        benchmark::DoNotOptimize(task.GetResult());
+    }
+}
+BENCHMARK(BM_Task_Run);
+
+//******************************************************************************
+// MARK: Latency
+//******************************************************************************
+
+/**
+ *  @brief The round trip latency of running a task on an idle pool and 
+ *         waiting for it.
+ */
+static void
+BM_Task_RunAsyncAwait(benchmark::State& rState)
+{
+    auto& rPool = GetPool(1);
+
+    for (auto _ : rState)
+    {
+        CppTask::Task<int> task([](){
+            return 1;
+        });
+
+        task.RunAsync(rPool);
+        benchmark::DoNotOptimize(task.AwaitResult());
+    }
+}
+BENCHMARK(BM_Task_RunAsyncAwait)->UseRealTime();
+
+//******************************************************************************
+// MARK: Throughput
+//******************************************************************************
+
+/**
+ *  @brief The throughput of empty tasks submitted as a batch, by thread 
+ *         count.
+ */
+static void
+BM_Pool_EmptyTaskThroughput(benchmark::State& rState)
+{
+    constexpr size_t c_taskCount = 1024;
+
+    auto& rPool = GetPool(static_cast<size_t>(rState.range(0)));
+
+    for (auto _ : rState)
+    {
+        std::vector<CppTask::Task<void>> tasks;
+        tasks.reserve(c_taskCount);
+
+        for (size_t i = 0; i < c_taskCount; ++i)
+        {
+            tasks.emplace_back([](){});
+        }
+
+        CppTask::RunAllAsync(tasks, rPool);
+
+        for (auto& rTask : tasks)
+        {
+            rTask.Await();
+        }
+    }
+
+    rState.SetItemsProcessed(rState.iterations() * c_taskCount);
+}
+BENCHMARK(BM_Pool_EmptyTaskThroughput)->Apply(ThreadCounts)->UseRealTime();
+
+/**
+ *  @brief Fan out to a number of tasks and combine their results once all
+ *         finished, by fan out width.
+ */
+static void
+BM_Pool_FanOutFanIn(benchmark::State& rState)
+{
+    auto width = static_cast<size_t>(rState.range(0));
+    auto& rPool = GetPool(std::max<unsigned>(std::thread::hardware_concurrency(), 1));
+
+    for (auto _ : rState)
+    {
+        std::vector<std::shared_ptr<CppTask::ITask<size_t>>> tasks;
+        tasks.reserve(width);
+
+        for (size_t i = 0; i < width; ++i)
+        {
+            auto pTask = std::make_shared<CppTask::Task<size_t>>([i](){
+                return i;
+            });
+
+            pTask->RunAsync(rPool);
+            tasks.emplace_back(std::move(pTask));
+        }
+
+        auto pAll = CppTask::WhenAll<size_t>(tasks);
+        size_t sum = 0;
+
+        for (auto value : pAll->AwaitResult())
+        {
+            sum += value;
+        }
+
+        benchmark::DoNotOptimize(sum);
+    }
+
+    rState.SetItemsProcessed(rState.iterations() * width);
+}
+BENCHMARK(BM_Pool_FanOutFanIn)->RangeMultiplier(8)->Range(8, 4096)->UseRealTime();
+
+/**
+ *  @brief Fan out to a number of children through a task group, the waiting
+ *         thread runs children as well, by fan out width.
+ */
+static void
+BM_TaskGroup_FanOut(benchmark::State& rState)
+{
+    auto width = static_cast<size_t>(rState.range(0));
+    auto& rPool = GetPool(std::max<unsigned>(std::thread::hardware_concurrency(), 1));
+
+    for (auto _ : rState)
+    {
+        std::atomic<size_t> sum(0);
+
+        CppTask::TaskGroup group(rPool);
+
+        for (size_t i = 0; i < width; ++i)
+        {
+            group.Spawn([&sum, i](){
+                sum.fetch_add(i, std::memory_order_relaxed);
+            });
+        }
+
+        group.Wait();
+        benchmark::DoNotOptimize(sum.load());
+    }
+
+    rState.SetItemsProcessed(rState.iterations() * width);
+}
+BENCHMARK(BM_TaskGroup_FanOut)->RangeMultiplier(8)->Range(8, 4096)->UseRealTime();
+
+//******************************************************************************
+// MARK: Worker Local
+//******************************************************************************
+
+/**
+ *  @brief Tasks filling a fresh scratch buffer each, which is allocated and 
+ *         faulted in per task, by buffer size in bytes.
+ */
+static void
+BM_Scratch_PerTask(benchmark::State& rState)
+{
+    auto size = static_cast<size_t>(rState.range(0));
+    auto& rPool = GetPool(std::max<unsigned>(std::thread::hardware_concurrency(), 1));
+
+    for (auto _ : rState)
+    {
+        CppTask::TaskGroup group(rPool);
+
+        for (size_t i = 0; i < 64; ++i)
+        {
+            group.Spawn([size](){
+                std::vector<char> buffer(size);
+                benchmark::DoNotOptimize(buffer.data());
+            });
+        }
+
+        group.Wait();
+    }
+
+    rState.SetItemsProcessed(rState.iterations() * 64);
+}
+BENCHMARK(BM_Scratch_PerTask)->RangeMultiplier(16)->Range(4 << 10, 1 << 20)->UseRealTime();
+
+/**
+ *  @brief Tasks filling the warm scratch buffer of their worker, by buffer 
+ *         size in bytes.
+ */
+static void
+BM_Scratch_WorkerLocal(benchmark::State& rState)
+{
+    auto size = static_cast<size_t>(rState.range(0));
+    auto& rPool = GetPool(std::max<unsigned>(std::thread::hardware_concurrency(), 1));
+    CppTask::WorkerLocal<std::vector<char>> scratch;
+
+    for (auto _ : rState)
+    {
+        CppTask::TaskGroup group(rPool);
+
+        for (size_t i = 0; i < 64; ++i)
+        {
+            group.Spawn([size, &scratch](){
+                auto& rBuffer = scratch.Get();
+                rBuffer.assign(size, 0);
+                benchmark::DoNotOptimize(rBuffer.data());
+            });
+        }
+
+        group.Wait();
+    }
+
+    rState.SetItemsProcessed(rState.iterations() * 64);
+}
+BENCHMARK(BM_Scratch_WorkerLocal)->RangeMultiplier(16)->Range(4 << 10, 1 << 20)->UseRealTime();
+
+//******************************************************************************
+// MARK: Timers
+//******************************************************************************
+
+/**
+ *  @brief Schedule a far away timer and cancel it again, the common fate of 
+ *         timeouts.
+ */
+static void
+BM_Timer_ScheduleCancel(benchmark::State& rState)
+{
+    for (auto _ : rState)
+    {
+        auto handle = CppTask::RunAfter(std::chrono::seconds(60), [](){});
+        benchmark::DoNotOptimize(handle.Cancel());
+    }
+}
+BENCHMARK(BM_Timer_ScheduleCancel);
+
+//******************************************************************************
+// MARK: Results
+//******************************************************************************
+
+/**
+ *  @brief The cost of an int result.
+ */
+static void
+BM_Result_Int(benchmark::State& rState)
+{
+    for (auto _ : rState)
+    {
+        CppTask::Task<int> task([](){
+            return 1;
+        });
+
+        task.Run();
+        benchmark::DoNotOptimize(std::move(task).TakeResult());
+    }
+}
+BENCHMARK(BM_Result_Int);
+
+/**
+ *  @brief The cost of a vector result, by element count. The result is moved
+ *         out, copying is up to the caller.
+ */
+static void
+BM_Result_Vector(benchmark::State& rState)
+{
+    auto size = static_cast<size_t>(rState.range(0));
+
+    for (auto _ : rState)
+    {
+        CppTask::Task<std::vector<int>> task([size](){
+            return std::vector<int>(size, 1);
+        });
+
+        task.Run();
+        benchmark::DoNotOptimize(std::move(task).TakeResult());
+    }
+
+    rState.SetBytesProcessed(rState.iterations() * size * sizeof(int));
+}
+BENCHMARK(BM_Result_Vector)->RangeMultiplier(32)->Range(1, 1 << 20);
+
+//******************************************************************************
+// MARK: Contention
+//******************************************************************************
+
+/**
+ *  @brief Many external threads submitting tasks to the same pool at once, by
+ *         submitting thread count.
+ */
+static void
+BM_Pool_ContendedSubmission(benchmark::State& rState)
+{
+    constexpr size_t c_taskCount = 64;
+
+    auto& rPool = GetPool(std::max<unsigned>(std::thread::hardware_concurrency(), 1));
+
+    for (auto _ : rState)
+    {
+        std::vector<CppTask::Task<void>> tasks;
+        tasks.reserve(c_taskCount);
+
+        for (size_t i = 0; i < c_taskCount; ++i)
+        {
+            tasks.emplace_back([](){});
+            tasks.back().RunAsync(rPool);
+        }
+
+        for (auto& rTask : tasks)
+        {
+            rTask.Await();
+        }
+    }
+
+    rState.SetItemsProcessed(rState.iterations() * c_taskCount);
+}
+BENCHMARK(BM_Pool_ContendedSubmission)->ThreadRange(1, 16)->UseRealTime();
+
+//******************************************************************************
+// MARK: Main
+//******************************************************************************
+
+BENCHMARK_MAIN();
@@ -0,0 +1,209 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef libcpptask_CppTask_Cancellation_h
+#define libcpptask_CppTask_Cancellation_h
+
+// STL
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <memory>
+
+// External
+
+// Project
+
+
+// Namespace
+namespace CppTask {
+
+//******************************************************************************
+// MARK: Cancellation Token
+//******************************************************************************
+
+/**
+ *  @brief The cancellation token allows to cancel tasks which did not start 
+ *         yet, and tells running task functions to stop early. Copies of a 
+ *         token share their state, cancelling one copy cancels all of them.
+ *
+ *         A token with a deadline is cancelled once the deadline passed.
+ *         Cancelling is cooperative, task functions which already run have
+ *         to check the token themselves.
+ */
+class CancellationToken
+{
+public:
+
+    //**************************************************************************
+    // MARK: Types
+    //**************************************************************************
+
+    using Clock = std::chrono::steady_clock;
+
+    //**************************************************************************
+    // MARK: Constructor
+    //**************************************************************************
+
+    /**
+     *  @brief Default constructor. Creates a token which is not cancelled.
+     */
+    CancellationToken()
+    : m_pState(std::make_shared<State>())
+    {}
+
+    /**
+     *  @brief Get a token which can never be cancelled. It does not allocate
+     *         any state and cancelling it has no effect.
+     *
+     *  @returns The token.
+     */
+    static CancellationToken
+    None() noexcept
+    {
+        return CancellationToken(nullptr);
+    }
+
+    //**************************************************************************
+    // MARK: Cancel
+    //**************************************************************************
+
+    /**
+     *  @brief Cancel the token. This function is thread-safe.
+     */
+    void
+    Cancel() noexcept
+    {
+        if (m_pState)
+        {
+            m_pState->m_cancelled.store(true, std::memory_order_release);
+        }
+    }
+
+    /**
+     *  @brief Cancel the token once a point in time passed. Replaces an 
+     *         earlier deadline. This function is thread-safe.
+     *
+     *  @param deadline The point in time to cancel at.
+     */
+    void
+    CancelAt(Clock::time_point deadline) noexcept
+    {
+        if (m_pState)
+        {
+            m_pState->m_deadline.store(deadline.time_since_epoch().count(), std::memory_order_release);
+        }
+    }
+
+    /**
+     *  @brief Cancel the token once a duration passed, starting now. Replaces
+     *         an earlier deadline. This function is thread-safe.
+     *
+     *  @param c_rDuration The duration to cancel after.
+     */
+    template <typename Rep, typename Period>
+    void
+    CancelAfter(const std::chrono::duration<Rep, Period>& c_rDuration) noexcept
+    {
+        CancelAt(Clock::now() + std::chrono::duration_cast<Clock::duration>(c_rDuration));
+    }
+
+    //**************************************************************************
+    // MARK: Getters
+    //**************************************************************************
+
+    /**
+     *  @brief Check if the token was cancelled, or its deadline passed. This
+     *         function is thread-safe.
+     *
+     *  @returns True if cancelled, false if not.
+     */
+    bool
+    IsCancelled() const noexcept
+    {
+        if (!m_pState)
+        {
+            return false;
+        }
+
+        if (m_pState->m_cancelled.load(std::memory_order_acquire))
+        {
+            return true;
+        }
+
+        // Only read the clock if there is a deadline to compare against
+        auto deadline = m_pState->m_deadline.load(std::memory_order_acquire);
+
+        if (deadline == s_noDeadline || Clock::now().time_since_epoch().count() < deadline)
+        {
+            return false;
+        }
+
+        m_pState->m_cancelled.store(true, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     *  @brief Check if the token can be cancelled at all.
+     *
+     *  @returns True if the token can be cancelled, false if not.
+     */
+    bool
+    CanBeCancelled() const noexcept
+    {
+        return static_cast<bool>(m_pState);
+    }
+
+private:
+
+    //**************************************************************************
+    // MARK: State
+    //**************************************************************************
+
+    static constexpr Clock::rep s_noDeadline = std::numeric_limits<Clock::rep>::max();
+
+    /**
+     *  @brief The state shared by all copies of a token.
+     */
+    struct State
+    {
+        std::atomic<bool> m_cancelled { false };
+        std::atomic<Clock::rep> m_deadline { s_noDeadline };
+    };
+
+    //**************************************************************************
+    // MARK: Constructor
+    //**************************************************************************
+
+    /**
+     *  @brief Stateless constructor.
+     */
+    explicit CancellationToken(std::nullptr_t) noexcept
+    : m_pState(nullptr)
+    {}
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    std::shared_ptr<State> m_pState;
+};
+
+// Namespace
+}
+
+#endif /* libcpptask_CppTask_Cancellation_h */
@@ -0,0 +1,543 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef libcpptask_CppTask_Coroutine_h
+#define libcpptask_CppTask_Coroutine_h
+
+#if !defined(__cpp_impl_coroutine)
+    #error "Coroutine support requires C++20, build with libcpptask_COROUTINES enabled!"
+#endif
+
+// STL
+#include <coroutine>
+#include <exception>
+
+// External
+
+// Project
+#include "./CppTask_Task.h"
+
+
+// Namespace
+namespace CppTask {
+
+//******************************************************************************
+// MARK: Resume Control Block
+//******************************************************************************
+
+/**
+ *  @brief The resume control block resumes a suspended coroutine on a pool
+ *         thread. One is created for every resumption.
+ */
+class ResumeControlBlock : public TaskThread
+{
+    template<typename T> friend class TaskAwaiter;
+    template<typename T> friend class CoroutineControlBlock;
+
+private:
+
+    //**************************************************************************
+    // MARK: Constructor
+    //**************************************************************************
+
+    /**
+     *  @brief Default constructor.
+     *
+     *  @param handle The coroutine to resume.
+     */
+    ResumeControlBlock(std::coroutine_handle<> handle) noexcept
+    : TaskThread(),
+      m_handle(handle)
+    {}
+
+    //**************************************************************************
+    // MARK: Resume
+    //**************************************************************************
+
+    /**
+     *  @brief Resume a coroutine on the thread pool.
+     *
+     *  @param handle The coroutine to resume.
+     */
+    static void
+    Resume(std::coroutine_handle<> handle)
+    {
+        TaskThread::Enqueue(IntrusivePointer<TaskThread>(new ResumeControlBlock(handle)));
+    }
+
+    //**************************************************************************
+    // MARK: Run Task
+    //**************************************************************************
+
+    /**
+     *  @brief Resume the coroutine.
+     */
+    void
+    Execute() override
+    {
+        m_handle.resume();
+    }
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    std::coroutine_handle<> m_handle;
+};
+
+//******************************************************************************
+// MARK: Task Awaiter
+//******************************************************************************
+
+/**
+ *  @brief The task awaiter suspends a coroutine until a task finished. The 
+ *         coroutine is resumed on the thread pool by the finishing task, no
+ *         thread is blocked waiting. Awaiting a task which was not run yet
+ *         starts it.
+ */
+template <typename T>
+class TaskAwaiter
+{
+    template<typename U> friend TaskAwaiter<U> operator co_await(const Task<U>& c_rTask);
+
+public:
+
+    //**************************************************************************
+    // MARK: Awaiter
+    //**************************************************************************
+
+    /**
+     *  @brief Check if the task is already done.
+     *
+     *  @returns True if the task is done, false if not.
+     */
+    bool
+    await_ready() const
+    {
+        return TaskThread::IsDone(m_pTaskThread->GetState());
+    }
+
+    /**
+     *  @brief Register the coroutine to resume once the task finished.
+     *
+     *  @param handle The suspended coroutine.
+     */
+    void
+    await_suspend(std::coroutine_handle<> handle)
+    {
+        // Copy what we need, the awaiter may be gone once the continuation
+        // was added, the coroutine is allowed to resume at that point
+        auto pTaskThread = m_pTaskThread;
+
+        pTaskThread->AddContinuation([handle](){
+            ResumeControlBlock::Resume(handle);
+        });
+
+        if (pTaskThread->GetState() == TaskState::WAITING)
+        {
+            try
+            {
+                TaskThread::Enqueue(pTaskThread);
+            }
+            catch (const Exception&)
+            {
+                // Started by somebody else in the meantime, or not runnable
+                // manually, continuations and completions start themselves
+            }
+        }
+    }
+
+    /**
+     *  @brief Get the task result once resumed.
+     *
+     *  @returns The task result.
+     */
+    T
+    await_resume() const
+    {
+        if constexpr (!std::is_void_v<T>)
+        {
+            return m_pTaskThread->GetResult();
+        }
+        else
+        {
+            m_pTaskThread->RethrowIfFaulted();
+        }
+    }
+
+private:
+
+    //**************************************************************************
+    // MARK: Constructor
+    //**************************************************************************
+
+    /**
+     *  @brief Default constructor.
+     *
+     *  @param pTaskThread The control block of the awaited task.
+     */
+    TaskAwaiter(IntrusivePointer<TaskControlBlock<T>> pTaskThread) noexcept
+    : m_pTaskThread(std::move(pTaskThread))
+    {}
+
+    /**
+     *  @brief Create an awaiter for a task.
+     *
+     *  @param c_rTask The task to await.
+     *
+     *  @returns The task awaiter.
+     */
+    static TaskAwaiter
+    FromTask(const Task<T>& c_rTask) noexcept
+    {
+        return TaskAwaiter(c_rTask.m_pTaskThread);
+    }
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    IntrusivePointer<TaskControlBlock<T>> m_pTaskThread;
+};
+
+/**
+ *  @brief Await a task inside a coroutine.
+ *
+ *  @param c_rTask The task to await.
+ *
+ *  @returns The task awaiter.
+ */
+template <typename T>
+TaskAwaiter<T>
+operator co_await(const Task<T>& c_rTask)
+{
+    return TaskAwaiter<T>::FromTask(c_rTask);
+}
+
+/**
+ *  @brief Await a shared task inside a coroutine.
+ *
+ *  @param c_rpTask The task to await.
+ *
+ *  @returns The task awaiter.
+ */
+template <typename T>
+TaskAwaiter<T>
+operator co_await(const std::shared_ptr<Task<T>>& c_rpTask)
+{
+    if (!c_rpTask)
+    {
+        throw Exception("Invalid parameters!");
+    }
+
+    return operator co_await(*c_rpTask);
+}
+
+//******************************************************************************
+// MARK: Coroutine Control Block
+//******************************************************************************
+
+template <typename T> class TaskPromise;
+
+/**
+ *  @brief The coroutine control block runs a coroutine returning a task. The
+ *         coroutine starts suspended and is first resumed once the task is
+ *         run. The control block owns the coroutine frame, and keeps itself
+ *         alive from the first resumption until the coroutine reached its 
+ *         end, tasks keep running once their last instance is gone.
+ */
+template <typename T>
+class CoroutineControlBlock : public CompletionControlBlock<T>
+{
+    template<typename U> friend class TaskPromise;
+    template<typename U> friend class TaskPromiseBase;
+
+public:
+
+    //**************************************************************************
+    // MARK: Destructor
+    //**************************************************************************
+
+    /**
+     *  @brief Default destructor. Destroys the coroutine frame.
+     */
+    ~CoroutineControlBlock() noexcept override
+    {
+        if (m_handle)
+        {
+            m_handle.destroy();
+        }
+    }
+
+private:
+
+    //**************************************************************************
+    // MARK: Constructor
+    //**************************************************************************
+
+    /**
+     *  @brief Default constructor.
+     *
+     *  @param handle The coroutine to run.
+     */
+    CoroutineControlBlock(std::coroutine_handle<> handle) noexcept
+    : CompletionControlBlock<T>(),
+      m_handle(handle)
+    {}
+
+    //**************************************************************************
+    // MARK: Run Task
+    //**************************************************************************
+
+    /**
+     *  @brief Start the coroutine.
+     */
+    void
+    Execute() override
+    {
+        // Released by the final awaiter, nobody else may own us while the 
+        // coroutine is suspended on another task
+        m_pSelf = IntrusivePointer<CoroutineControlBlock<T>>(this);
+        m_handle.resume();
+    }
+
+    /**
+     *  @brief Check if the coroutine can be enqueued.
+     *
+     *  @returns Always true, coroutines are started like any other task.
+     */
+    bool
+    IsReady() const override
+    {
+        return true;
+    }
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    std::coroutine_handle<> m_handle;
+    IntrusivePointer<CoroutineControlBlock<T>> m_pSelf { nullptr };
+};
+
+//******************************************************************************
+// MARK: Task Promise
+//******************************************************************************
+
+/**
+ *  @brief The task promise base implements the coroutine promise parts 
+ *         shared by all result types.
+ */
+template <typename T>
+class TaskPromiseBase
+{
+public:
+
+    //**************************************************************************
+    // MARK: Final Awaiter
+    //**************************************************************************
+
+    /**
+     *  @brief The final awaiter finishes or faults the task once the coroutine
+     *         reached its end. The coroutine stays suspended until the task is
+     *         destroyed, so the frame outlives the call to SetFinished().
+     */
+    struct FinalAwaiter
+    {
+        bool
+        await_ready() const noexcept
+        {
+            return false;
+        }
+
+        void
+        await_suspend(std::coroutine_handle<>) const noexcept
+        {
+            // Dropping the last reference destroys the frame this awaiter 
+            // lives in, which is fine once nothing touches it anymore
+            auto pSelf = std::move(m_pTaskThread->m_pSelf);
+
+            if (m_pException)
+            {
+                m_pTaskThread->SetFaulted(m_pException);
+            }
+            else
+            {
+                m_pTaskThread->SetFinished();
+            }
+        }
+
+        void
+        await_resume() const noexcept
+        {}
+
+        CoroutineControlBlock<T>* m_pTaskThread;
+        std::exception_ptr m_pException;
+    };
+
+    //**************************************************************************
+    // MARK: Promise
+    //**************************************************************************
+
+    /**
+     *  @brief Coroutine tasks are lazy and start once run.
+     *
+     *  @returns The initial awaiter.
+     */
+    std::suspend_always
+    initial_suspend() const noexcept
+    {
+        return {};
+    }
+
+    /**
+     *  @brief Finish the task at the end of the coroutine.
+     *
+     *  @returns The final awaiter.
+     */
+    FinalAwaiter
+    final_suspend() const noexcept
+    {
+        return FinalAwaiter { m_pTaskThread, m_pException };
+    }
+
+    /**
+     *  @brief Exceptions leaving the coroutine fault the task, like they do
+     *         for a task function. The task faults once the coroutine is 
+     *         suspended for good, waiters may destroy it right away.
+     */
+    void
+    unhandled_exception() noexcept
+    {
+        m_pException = std::current_exception();
+    }
+
+protected:
+
+    //**************************************************************************
+    // MARK: Task
+    //**************************************************************************
+
+    /**
+     *  @brief Create the task for the coroutine.
+     *
+     *  @param handle The coroutine of the promise.
+     *
+     *  @returns The coroutine task.
+     */
+    Task<T>
+    CreateTask(std::coroutine_handle<> handle)
+    {
+        IntrusivePointer<CoroutineControlBlock<T>> pTaskThread(new CoroutineControlBlock<T>(handle));
+        m_pTaskThread = pTaskThread.get();
+
+        return Task<T>(pTaskThread);
+    }
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    CoroutineControlBlock<T>* m_pTaskThread = nullptr;
+    std::exception_ptr m_pException;
+};
+
+/**
+ *  @brief The task promise allows coroutines to return a task with a result.
+ */
+template <typename T>
+class TaskPromise : public TaskPromiseBase<T>
+{
+public:
+
+    //**************************************************************************
+    // MARK: Promise
+    //**************************************************************************
+
+    /**
+     *  @brief Create the task returned by the coroutine.
+     *
+     *  @returns The coroutine task.
+     */
+    Task<T>
+    get_return_object()
+    {
+        return this->CreateTask(std::coroutine_handle<TaskPromise>::from_promise(*this));
+    }
+
+    /**
+     *  @brief Store the coroutine result.
+     *
+     *  @param result The result to store.
+     */
+    template <typename U>
+    void
+    return_value(U&& result)
+    {
+        this->m_pTaskThread->SetResult(std::forward<U>(result));
+    }
+};
+
+/**
+ *  @brief The task promise allows coroutines to return a task without 
+ *         result.
+ */
+template <>
+class TaskPromise<void> : public TaskPromiseBase<void>
+{
+public:
+
+    //**************************************************************************
+    // MARK: Promise
+    //**************************************************************************
+
+    /**
+     *  @brief Create the task returned by the coroutine.
+     *
+     *  @returns The coroutine task.
+     */
+    Task<void>
+    get_return_object()
+    {
+        return CreateTask(std::coroutine_handle<TaskPromise>::from_promise(*this));
+    }
+
+    /**
+     *  @brief Nothing to store for void coroutines.
+     */
+    void
+    return_void() const noexcept
+    {}
+};
+
+// Namespace
+}
+
+//******************************************************************************
+// MARK: Coroutine Traits
+//******************************************************************************
+
+/**
+ *  @brief Allow functions returning a task to be coroutines.
+ */
+template <typename T, typename... Args>
+struct std::coroutine_traits<CppTask::Task<T>, Args...>
+{
+    using promise_type = CppTask::TaskPromise<T>;
+};
+
+#endif /* libcpptask_CppTask_Coroutine_h */
@@ -0,0 +1,131 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef libcpptask_CppTask_IO_h
+#define libcpptask_CppTask_IO_h
+
+// STL
+#include <chrono>
+#include <cstddef>
+
+// External
+
+// Project
+#include "./CppTask_Task.h"
+
+
+// Namespace
+namespace CppTask {
+
+/**
+ *  @brief The I/O class runs reads, writes and timers on a reactor thread 
+ *         instead of a pool thread. Every operation returns a task which the
+ *         reactor finishes once the operation completed, so pool threads 
+ *         never block on I/O. Await the task, add a continuation or co_await
+ *         it from a coroutine.
+ *
+ *         The reactor uses epoll and is started on first use. I/O is compiled
+ *         out on other platforms or unless the library is built with the
+ *         libcpptask_IO option.
+ *
+ *         Failed operations fault their task with a std::system_error. The
+ *         buffer of an operation has to stay valid until its task is done.
+ */
+class IO
+{
+public:
+
+    //**************************************************************************
+    // MARK: Availability
+    //**************************************************************************
+
+    /**
+     *  @brief Check if I/O was compiled into the library.
+     *
+     *  @returns True if I/O is available, false if not.
+     */
+    static bool
+    IsAvailable() noexcept;
+
+    //**************************************************************************
+    // MARK: Operations
+    //**************************************************************************
+
+    /**
+     *  @brief Read up to a number of bytes once the file descriptor is 
+     *         readable. Regular files are always readable, they are read on
+     *         the calling thread. This function is thread-safe.
+     *
+     *  @param fileDescriptor The file descriptor to read from.
+     *  @param pBuffer The buffer to read into.
+     *  @param size The buffer size.
+     *
+     *  @returns The task with the number of bytes read, 0 at the end of file.
+     */
+    static Task<size_t>
+    ReadAsync(int fileDescriptor, void* pBuffer, size_t size);
+
+    /**
+     *  @brief Write up to a number of bytes once the file descriptor is 
+     *         writable. Regular files are always writable, they are written on
+     *         the calling thread. This function is thread-safe.
+     *
+     *  @param fileDescriptor The file descriptor to write to.
+     *  @param c_pBuffer The buffer to write from.
+     *  @param size The buffer size.
+     *
+     *  @returns The task with the number of bytes written.
+     */
+    static Task<size_t>
+    WriteAsync(int fileDescriptor, const void* c_pBuffer, size_t size);
+
+    /**
+     *  @brief Start a timer. Throws a std::system_error if no timer can be 
+     *         created. This function is thread-safe.
+     *
+     *  @param duration The time until the timer expires.
+     *
+     *  @returns The task finished once the timer expired.
+     */
+    static Task<void>
+    Timer(std::chrono::nanoseconds duration);
+
+private:
+
+    //**************************************************************************
+    // MARK: Task
+    //**************************************************************************
+
+    /**
+     *  @brief Create the task for a control block.
+     *
+     *  @param pTaskThread The control block of the task.
+     *
+     *  @returns The task.
+     */
+    template <typename T>
+    static Task<T>
+    MakeTask(IntrusivePointer<TaskControlBlock<T>> pTaskThread)
+    {
+        return Task<T>(std::move(pTaskThread));
+    }
+};
+
+// Namespace
+}
+
+#endif /* libcpptask_CppTask_IO_h */
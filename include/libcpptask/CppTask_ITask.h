@@ -19,6 +19,8 @@
 #define libcpptask_CppTask_ITask_h
 
 // STL
+#include <chrono>
+#include <type_traits>
 
 // External
 
@@ -34,15 +36,47 @@ namespace CppTask {
 //******************************************************************************
 
 /**
- *  @brief The states a task can inhabit.
+ *  @brief The states a task can inhabit. Finished, cancelled and faulted 
+ *         tasks are done and never change their state again. Faulted tasks
+ *         threw an exception, which is rethrown when retrieving the result.
  */
 enum TaskState
 {
     WAITING = 0,
     RUNNING = 1,
-    FINISHED = 2
+    FINISHED = 2,
+    CANCELLED = 3,
+    FAULTED = 4
 };
 
+//******************************************************************************
+// MARK: Task Priority
+//******************************************************************************
+
+/**
+ *  @brief The priorities a task can be run with. Higher priority tasks are
+ *         run first, lower priority tasks still get a share of the pool.
+ */
+enum TaskPriority
+{
+    LOW = 0,
+    NORMAL = 1,
+    HIGH = 2
+};
+
+//******************************************************************************
+// MARK: Task Result Reference
+//******************************************************************************
+
+/**
+ *  @brief The type returned when referencing a task result. A const reference
+ *         to the result type, or void for tasks without a result.
+ */
+template <typename T>
+using TaskResultReference = std::conditional_t<std::is_void_v<T>, 
+                                               void, 
+                                               std::add_lvalue_reference_t<std::add_const_t<T>>>;
+
 //******************************************************************************
 // MARK: Task Interface
 //******************************************************************************
@@ -95,13 +129,55 @@ public:
     Await() const = 0;
 
     /**
-     *  @brief Get the result of a finished task. This function is thread-safe.
+     *  @brief Wait for a task to be done for at most a duration. This 
+     *         function is thread-safe.
+     *
+     *  @param timeout The maximum duration to wait for.
+     *
+     *  @returns True if the task is done, false if the wait timed out.
+     */
+    virtual bool
+    AwaitFor(std::chrono::nanoseconds timeout) const = 0;
+
+    /**
+     *  @brief Wait for a task to be done until a point in time. This function 
+     *         is thread-safe.
+     *
+     *  @param deadline The point in time to wait until.
+     *
+     *  @returns True if the task is done, false if the wait timed out.
+     */
+    virtual bool
+    AwaitUntil(std::chrono::steady_clock::time_point deadline) const = 0;
+
+    /**
+     *  @brief Get the result of a finished task. Rethrows the exception of a
+     *         faulted task. This function is thread-safe.
      *
      *  @returns The task result.
      */
     virtual T
     GetResult() const = 0;
 
+    /**
+     *  @brief Get a reference to the result of a finished task, without
+     *         copying it. This function is thread-safe.
+     *
+     *  @returns The task result reference.
+     */
+    virtual TaskResultReference<T>
+    GetResultRef() const = 0;
+
+    /**
+     *  @brief Move the result out of a finished task, without copying it. 
+     *         The result is no longer available afterwards. This function is
+     *         thread-safe.
+     *
+     *  @returns The task result.
+     */
+    virtual T
+    TakeResult() && = 0;
+
     /**
      *  @brief Wait for a task to finish and return the task result. This 
      *         function will return the already finished result if one exists.
@@ -125,6 +201,15 @@ public:
     virtual TaskState
     GetState() const = 0;
 
+    /**
+     *  @brief Check if the task is done, either finished, cancelled or 
+     *         faulted, without blocking. This function is thread-safe.
+     * 
+     *  @returns True if the task is done, false if not.
+     */
+    virtual bool
+    IsFinished() const = 0;
+
 protected:
 
     //**************************************************************************
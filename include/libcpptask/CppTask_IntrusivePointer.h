@@ -0,0 +1,268 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef libcpptask_CppTask_IntrusivePointer_h
+#define libcpptask_CppTask_IntrusivePointer_h
+
+// STL
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+// External
+
+// Project
+
+
+// Namespace
+namespace CppTask {
+
+/**
+ *  @brief The intrusive pointer shares ownership of an object which carries
+ *         its own reference count. Unlike std::shared_ptr no separate
+ *         control block is allocated, the object is the control block.
+ *
+ *         The pointed to type has to provide AddReference() and 
+ *         ReleaseReference() functions. ReleaseReference() is expected to
+ *         destroy the object once the last reference is released.
+ */
+template <typename T>
+class IntrusivePointer
+{
+    template<typename U> friend class IntrusivePointer;
+
+public:
+
+    //**************************************************************************
+    // MARK: Constructor / Destructor
+    //**************************************************************************
+
+    /**
+     *  @brief Default constructor.
+     */
+    IntrusivePointer() noexcept
+    : m_pObject(nullptr)
+    {}
+
+    /**
+     *  @brief nullptr constructor.
+     */
+    IntrusivePointer(std::nullptr_t) noexcept
+    : m_pObject(nullptr)
+    {}
+
+    /**
+     *  @brief Object constructor. Takes a new reference to the object.
+     *
+     *  @param pObject The object to point to.
+     */
+    explicit IntrusivePointer(T* pObject) noexcept
+    : m_pObject(pObject)
+    {
+        if (m_pObject)
+        {
+            m_pObject->AddReference();
+        }
+    }
+
+    /**
+     *  @brief Copy constructor.
+     *
+     *  @param c_rPointer IntrusivePointer class source.
+     */
+    IntrusivePointer(const IntrusivePointer& c_rPointer) noexcept
+    : IntrusivePointer(c_rPointer.m_pObject)
+    {}
+
+    /**
+     *  @brief Converting copy constructor.
+     *
+     *  @param c_rPointer IntrusivePointer class source.
+     */
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    IntrusivePointer(const IntrusivePointer<U>& c_rPointer) noexcept
+    : IntrusivePointer(static_cast<T*>(c_rPointer.m_pObject))
+    {}
+
+    /**
+     *  @brief Move constructor.
+     *
+     *  @param rPointer IntrusivePointer class source.
+     */
+    IntrusivePointer(IntrusivePointer&& rPointer) noexcept
+    : m_pObject(rPointer.m_pObject)
+    {
+        rPointer.m_pObject = nullptr;
+    }
+
+    /**
+     *  @brief Converting move constructor.
+     *
+     *  @param rPointer IntrusivePointer class source.
+     */
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    IntrusivePointer(IntrusivePointer<U>&& rPointer) noexcept
+    : m_pObject(static_cast<T*>(rPointer.m_pObject))
+    {
+        rPointer.m_pObject = nullptr;
+    }
+
+    /**
+     *  @brief Default destructor.
+     */
+    ~IntrusivePointer() noexcept
+    {
+        if (m_pObject)
+        {
+            m_pObject->ReleaseReference();
+        }
+    }
+
+    //**************************************************************************
+    // MARK: Operators
+    //**************************************************************************
+
+    /**
+     *  @brief Copy assignment operator.
+     *
+     *  @param c_rPointer IntrusivePointer class source.
+     *
+     *  @returns The updated pointer.
+     */
+    IntrusivePointer&
+    operator=(const IntrusivePointer& c_rPointer) noexcept
+    {
+        IntrusivePointer(c_rPointer).swap(*this);
+        return *this;
+    }
+
+    /**
+     *  @brief Move assignment operator.
+     *
+     *  @param rPointer IntrusivePointer class source.
+     *
+     *  @returns The updated pointer.
+     */
+    IntrusivePointer&
+    operator=(IntrusivePointer&& rPointer) noexcept
+    {
+        IntrusivePointer(std::move(rPointer)).swap(*this);
+        return *this;
+    }
+
+    /**
+     *  @brief Access the object.
+     *
+     *  @returns The object.
+     */
+    T*
+    operator->() const noexcept
+    {
+        return m_pObject;
+    }
+
+    /**
+     *  @brief Access the object.
+     *
+     *  @returns The object.
+     */
+    T&
+    operator*() const noexcept
+    {
+        return *m_pObject;
+    }
+
+    /**
+     *  @brief Check if an object is pointed to.
+     *
+     *  @returns True if an object is pointed to, false if not.
+     */
+    explicit
+    operator bool() const noexcept
+    {
+        return m_pObject != nullptr;
+    }
+
+    /**
+     *  @brief Compare two pointers.
+     *
+     *  @param c_rPointer The pointer to compare with.
+     *
+     *  @returns True if both point to the same object, false if not.
+     */
+    bool
+    operator==(const IntrusivePointer& c_rPointer) const noexcept
+    {
+        return m_pObject == c_rPointer.m_pObject;
+    }
+
+    /**
+     *  @brief Compare two pointers.
+     *
+     *  @param c_rPointer The pointer to compare with.
+     *
+     *  @returns True if both point to different objects, false if not.
+     */
+    bool
+    operator!=(const IntrusivePointer& c_rPointer) const noexcept
+    {
+        return m_pObject != c_rPointer.m_pObject;
+    }
+
+    //**************************************************************************
+    // MARK: Getters
+    //**************************************************************************
+
+    /**
+     *  @brief Get the raw object pointer.
+     *
+     *  @returns The raw object pointer.
+     */
+    T*
+    get() const noexcept
+    {
+        return m_pObject;
+    }
+
+    //**************************************************************************
+    // MARK: Swap
+    //**************************************************************************
+
+    /**
+     *  @brief Swap the pointed to objects of two pointers.
+     *
+     *  @param rPointer The pointer to swap with.
+     */
+    void
+    swap(IntrusivePointer& rPointer) noexcept
+    {
+        std::swap(m_pObject, rPointer.m_pObject);
+    }
+
+private:
+    
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    T* m_pObject;
+};
+
+// Namespace
+}
+
+#endif /* libcpptask_CppTask_IntrusivePointer_h */
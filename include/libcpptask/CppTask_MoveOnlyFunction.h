@@ -0,0 +1,369 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef libcpptask_CppTask_MoveOnlyFunction_h
+#define libcpptask_CppTask_MoveOnlyFunction_h
+
+// STL
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// External
+
+// Project
+#include "./CppTask_TaskAllocator.h"
+
+
+// Namespace
+namespace CppTask {
+
+template <typename Signature>
+class MoveOnlyFunction;
+
+/**
+ *  @brief The move-only function wraps any callable, including callables 
+ *         which can not be copied like lambdas capturing a unique pointer. 
+ *         Callables small enough for the inline buffer and nothrow movable
+ *         are stored without an allocation, larger ones are allocated from
+ *         the task memory resource.
+ */
+template <typename R, typename... Args>
+class MoveOnlyFunction<R(Args...)>
+{
+public:
+
+    /**
+     *  @brief The size of the inline buffer.
+     */
+    static constexpr std::size_t s_bufferSize = 6 * sizeof(void*);
+
+    //**************************************************************************
+    // MARK: Constructor / Destructor
+    //**************************************************************************
+
+    /**
+     *  @brief Default constructor. Creates an empty function.
+     */
+    MoveOnlyFunction() noexcept = default;
+
+    /**
+     *  @brief Null constructor. Creates an empty function.
+     */
+    MoveOnlyFunction(std::nullptr_t) noexcept
+    {}
+
+    /**
+     *  @brief Callable constructor. The callable is moved or copied into the
+     *         function once, depending on how it is passed. Null function
+     *         pointers and empty std::function objects create an empty 
+     *         function.
+     *
+     *  @param function The callable to wrap.
+     */
+    template <typename F, 
+              typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, MoveOnlyFunction> &&
+                                          std::is_invocable_r_v<R, std::decay_t<F>&, Args...>>>
+    MoveOnlyFunction(F&& function)
+    {
+        using Callable = std::decay_t<F>;
+
+        if constexpr (IsNullable<Callable>())
+        {
+            if (!function)
+            {
+                return;
+            }
+        }
+
+        if constexpr (IsInline<Callable>())
+        {
+            ::new (static_cast<void*>(m_buffer)) Callable(std::forward<F>(function));
+            m_pOperations = &s_inlineOperations<Callable>;
+        }
+        else if constexpr (alignof(Callable) > alignof(std::max_align_t))
+        {
+            *reinterpret_cast<Callable**>(m_buffer) = new Callable(std::forward<F>(function));
+            m_pOperations = &s_heapOperations<Callable>;
+        }
+        else
+        {
+            auto pMemory = TaskAllocator::Allocate(sizeof(Callable));
+
+            try
+            {
+                *reinterpret_cast<Callable**>(m_buffer) = ::new (pMemory) Callable(std::forward<F>(function));
+            }
+            catch (...)
+            {
+                TaskAllocator::Deallocate(pMemory, sizeof(Callable));
+                throw;
+            }
+
+            m_pOperations = &s_heapOperations<Callable>;
+        }
+    }
+
+    /**
+     *  @brief Copy constructor. Disabled for this class.
+     *
+     *  @param c_rFunction MoveOnlyFunction class source.
+     */
+    MoveOnlyFunction(const MoveOnlyFunction& c_rFunction) = delete;
+
+    /**
+     *  @brief Move constructor.
+     *
+     *  @param rFunction MoveOnlyFunction class source.
+     */
+    MoveOnlyFunction(MoveOnlyFunction&& rFunction) noexcept
+    {
+        MoveFrom(rFunction);
+    }
+
+    /**
+     *  @brief Default destructor.
+     */
+    ~MoveOnlyFunction() noexcept
+    {
+        Clear();
+    }
+
+    //**************************************************************************
+    // MARK: Operator
+    //**************************************************************************
+
+    /**
+     *  @brief Copy assignment operator. Disabled for this class.
+     *
+     *  @param c_rFunction MoveOnlyFunction class source.
+     */
+    MoveOnlyFunction&
+    operator=(const MoveOnlyFunction& c_rFunction) = delete;
+
+    /**
+     *  @brief Move assignment operator.
+     *
+     *  @param rFunction MoveOnlyFunction class source.
+     *
+     *  @returns The function.
+     */
+    MoveOnlyFunction&
+    operator=(MoveOnlyFunction&& rFunction) noexcept
+    {
+        if (this != &rFunction)
+        {
+            Clear();
+            MoveFrom(rFunction);
+        }
+
+        return *this;
+    }
+
+    /**
+     *  @brief Check if the function wraps a callable.
+     *
+     *  @returns True if not empty, false if empty.
+     */
+    explicit
+    operator bool() const noexcept
+    {
+        return m_pOperations != nullptr;
+    }
+
+    /**
+     *  @brief Call the wrapped callable. Throws std::bad_function_call if 
+     *         empty.
+     *
+     *  @param args The call arguments.
+     *
+     *  @returns The call result.
+     */
+    R
+    operator()(Args... args)
+    {
+        if (!m_pOperations)
+        {
+            throw std::bad_function_call();
+        }
+
+        return m_pOperations->m_pInvoke(m_buffer, std::forward<Args>(args)...);
+    }
+
+private:
+
+    //**************************************************************************
+    // MARK: Operations
+    //**************************************************************************
+
+    /**
+     *  @brief The operations on a stored callable type.
+     */
+    struct Operations
+    {
+        R (*m_pInvoke)(void* pStorage, Args&&... args);
+        void (*m_pMove)(void* pTarget, void* pSource) noexcept;
+        void (*m_pDestroy)(void* pStorage) noexcept;
+    };
+
+    /**
+     *  @brief Detect std::function specializations.
+     */
+    template <typename F>
+    struct IsStdFunction : std::false_type {};
+
+    template <typename Signature>
+    struct IsStdFunction<std::function<Signature>> : std::true_type {};
+
+    /**
+     *  @brief Check if a callable type can be null.
+     *
+     *  @returns True if nullable, false if not.
+     */
+    template <typename F>
+    static constexpr bool
+    IsNullable() noexcept
+    {
+        return std::is_pointer_v<F> || 
+               std::is_member_pointer_v<F> ||
+               IsStdFunction<F>::value;
+    }
+
+    /**
+     *  @brief Check if a callable type is stored in the inline buffer.
+     *
+     *  @returns True if stored inline, false if allocated.
+     */
+    template <typename F>
+    static constexpr bool
+    IsInline() noexcept
+    {
+        return sizeof(F) <= s_bufferSize && 
+               alignof(F) <= alignof(std::max_align_t) &&
+               std::is_nothrow_move_constructible_v<F>;
+    }
+
+    /**
+     *  @brief Call a callable, discarding its result for a void signature.
+     *
+     *  @param rCallable The callable to call.
+     *  @param args The arguments to call with.
+     *
+     *  @returns The result of the callable.
+     */
+    template <typename F>
+    static R
+    Invoke(F& rCallable, Args&&... args)
+    {
+        if constexpr (std::is_void_v<R>)
+        {
+            std::invoke(rCallable, std::forward<Args>(args)...);
+        }
+        else
+        {
+            return std::invoke(rCallable, std::forward<Args>(args)...);
+        }
+    }
+
+    /**
+     *  @brief The operations of callables stored in the inline buffer.
+     */
+    template <typename F>
+    static constexpr Operations s_inlineOperations = {
+        [](void* pStorage, Args&&... args) -> R {
+            return Invoke(*static_cast<F*>(pStorage), std::forward<Args>(args)...);
+        },
+        [](void* pTarget, void* pSource) noexcept {
+            ::new (pTarget) F(std::move(*static_cast<F*>(pSource)));
+            static_cast<F*>(pSource)->~F();
+        },
+        [](void* pStorage) noexcept {
+            static_cast<F*>(pStorage)->~F();
+        }
+    };
+
+    /**
+     *  @brief The operations of allocated callables, the buffer holds the 
+     *         pointer to the callable.
+     */
+    template <typename F>
+    static constexpr Operations s_heapOperations = {
+        [](void* pStorage, Args&&... args) -> R {
+            return Invoke(**static_cast<F**>(pStorage), std::forward<Args>(args)...);
+        },
+        [](void* pTarget, void* pSource) noexcept {
+            *static_cast<F**>(pTarget) = *static_cast<F**>(pSource);
+        },
+        [](void* pStorage) noexcept {
+            auto pCallable = *static_cast<F**>(pStorage);
+
+            if constexpr (alignof(F) > alignof(std::max_align_t))
+            {
+                delete pCallable;
+            }
+            else
+            {
+                pCallable->~F();
+                TaskAllocator::Deallocate(pCallable, sizeof(F));
+            }
+        }
+    };
+
+    /**
+     *  @brief Destroy the stored callable, leaving the function empty.
+     */
+    void
+    Clear() noexcept
+    {
+        if (m_pOperations)
+        {
+            m_pOperations->m_pDestroy(m_buffer);
+            m_pOperations = nullptr;
+        }
+    }
+
+    /**
+     *  @brief Take the callable of another function, leaving it empty. This
+     *         function has to be empty.
+     *
+     *  @param rFunction The function to take the callable of.
+     */
+    void
+    MoveFrom(MoveOnlyFunction& rFunction) noexcept
+    {
+        if (rFunction.m_pOperations)
+        {
+            rFunction.m_pOperations->m_pMove(m_buffer, rFunction.m_buffer);
+            m_pOperations = rFunction.m_pOperations;
+            rFunction.m_pOperations = nullptr;
+        }
+    }
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    alignas(std::max_align_t) unsigned char m_buffer[s_bufferSize];
+    const Operations* m_pOperations = nullptr;
+};
+
+// Namespace
+}
+
+#endif /* libcpptask_CppTask_MoveOnlyFunction_h */
@@ -0,0 +1,200 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef libcpptask_CppTask_Parallel_h
+#define libcpptask_CppTask_Parallel_h
+
+// STL
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include <cstddef>
+
+// External
+
+// Project
+#include "./CppTask_Exception.h"
+
+
+// Namespace
+namespace CppTask {
+
+//******************************************************************************
+// MARK: Parallel Chunks
+//******************************************************************************
+
+/**
+ *  @brief Run a function over the index range [0, count) split into chunks on
+ *         the thread pool. The calling thread runs chunks as well and only
+ *         waits for chunks already taken by pool threads.
+ *
+ *         Chunks are claimed dynamically. Every claim takes a share of the 
+ *         remaining range, so chunks start large and shrink towards the 
+ *         grain size at the end to balance the load between threads. Only
+ *         one task per pool thread is created, not one per chunk.
+ *
+ *         The first exception thrown by the function is rethrown once all
+ *         claimed chunks finished. This function is thread-safe.
+ *
+ *  @param count The number of indices.
+ *  @param grainSize The minimum chunk size.
+ *  @param c_rFunction The function to run for the index range [begin, end).
+ */
+void
+ParallelChunks(size_t count,
+               size_t grainSize,
+               const std::function<void(size_t begin, size_t end)>& c_rFunction);
+
+//******************************************************************************
+// MARK: Parallel For
+//******************************************************************************
+
+/**
+ *  @brief Run a function for each index in [begin, end) on the thread pool.
+ *         The calling thread helps running the function. See 
+ *         ParallelChunks().
+ *
+ *  @param begin The first index.
+ *  @param end The index after the last index.
+ *  @param function The function to run for a single index.
+ *  @param grainSize The minimum number of indices run as one chunk.
+ */
+template <typename I, typename F>
+void
+ParallelFor(I begin, I end, F&& function, size_t grainSize = 1)
+{
+    if (end <= begin)
+    {
+        return;
+    }
+
+    ParallelChunks(static_cast<size_t>(end - begin), grainSize, [begin, &function](size_t chunkBegin, size_t chunkEnd){
+        for (size_t i = chunkBegin; i < chunkEnd; ++i)
+        {
+            function(static_cast<I>(begin + static_cast<I>(i)));
+        }
+    });
+}
+
+//******************************************************************************
+// MARK: Parallel Transform
+//******************************************************************************
+
+/**
+ *  @brief Transform the range [first, last) into the range beginning at 
+ *         output on the thread pool. Both ranges have to be random access.
+ *         The calling thread helps running the function. See 
+ *         ParallelChunks().
+ *
+ *  @param first The first input element.
+ *  @param last The element after the last input element.
+ *  @param output The first output element.
+ *  @param function The function to transform a single element.
+ *  @param grainSize The minimum number of elements run as one chunk.
+ *
+ *  @returns The element after the last output element.
+ */
+template <typename InputIterator, typename OutputIterator, typename F>
+OutputIterator
+ParallelTransform(InputIterator first, 
+                  InputIterator last, 
+                  OutputIterator output, 
+                  F&& function, 
+                  size_t grainSize = 1)
+{
+    auto count = std::distance(first, last);
+
+    if (count <= 0)
+    {
+        return output;
+    }
+
+    ParallelChunks(static_cast<size_t>(count), grainSize, [first, output, &function](size_t chunkBegin, size_t chunkEnd){
+        std::transform(first + chunkBegin, first + chunkEnd, output + chunkBegin, function);
+    });
+
+    return output + count;
+}
+
+//******************************************************************************
+// MARK: Parallel Reduce
+//******************************************************************************
+
+/**
+ *  @brief Reduce the range [first, last) on the thread pool. The range has to
+ *         be random access. The reduce function has to be associative, it 
+ *         does not need to be commutative: chunk results are combined in 
+ *         range order. The calling thread helps running the function. See 
+ *         ParallelChunks().
+ *
+ *  @param first The first element.
+ *  @param last The element after the last element.
+ *  @param init The initial value, combined with the first element.
+ *  @param function The function combining two values.
+ *  @param grainSize The minimum number of elements run as one chunk.
+ *
+ *  @returns The reduced value.
+ */
+template <typename InputIterator, typename T, typename F>
+T
+ParallelReduce(InputIterator first, 
+               InputIterator last, 
+               T init, 
+               F&& function, 
+               size_t grainSize = 1)
+{
+    auto count = std::distance(first, last);
+
+    if (count <= 0)
+    {
+        return init;
+    }
+
+    std::mutex mutex;
+    std::vector<std::pair<size_t, T>> partials;
+
+    ParallelChunks(static_cast<size_t>(count), grainSize, [&](size_t chunkBegin, size_t chunkEnd){
+        T partial = *(first + chunkBegin);
+
+        for (size_t i = chunkBegin + 1; i < chunkEnd; ++i)
+        {
+            partial = function(std::move(partial), *(first + i));
+        }
+
+        std::lock_guard<std::mutex> lockGuard(mutex);
+        partials.emplace_back(chunkBegin, std::move(partial));
+    });
+
+    std::sort(partials.begin(), partials.end(), [](const auto& c_rFirst, const auto& c_rSecond){
+        return c_rFirst.first < c_rSecond.first;
+    });
+
+    for (auto& rPartial : partials)
+    {
+        init = function(std::move(init), std::move(rPartial.second));
+    }
+
+    return init;
+}
+
+// Namespace
+}
+
+#endif /* libcpptask_CppTask_Parallel_h */
@@ -0,0 +1,435 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef libcpptask_CppTask_Pool_h
+#define libcpptask_CppTask_Pool_h
+
+// STL
+#include <array>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+// External
+
+// Project
+#include "./CppTask_Exception.h"
+
+
+// Namespace
+namespace CppTask {
+
+// Forward declarations
+class ThreadPool;
+
+//******************************************************************************
+// MARK: Pool Options
+//******************************************************************************
+
+/**
+ *  @brief The pool options configure the threads of a pool.
+ */
+struct PoolOptions
+{
+    /**
+     *  @brief The number of pool threads. Zero uses the default thread count
+     *         of all but one hardware thread, or the forced thread count if
+     *         the library was built with one.
+     */
+    size_t m_threadCount = 0;
+
+    /**
+     *  @brief The name prefix of the pool threads. Threads are named with the
+     *         prefix followed by the thread index. An empty prefix leaves the
+     *         threads unnamed. Names may be shortened by the platform.
+     */
+    std::string m_threadName;
+
+    /**
+     *  @brief The CPUs each pool thread is pinned to, by thread index. Threads
+     *         past the end of the list reuse the list from the start. An empty
+     *         list leaves the threads unpinned unless the pool is NUMA aware.
+     *         Pinning is only supported on Linux and ignored elsewhere.
+     */
+    std::vector<std::vector<size_t>> m_threadAffinity;
+
+    /**
+     *  @brief Spread the pool threads across the NUMA nodes of the machine and
+     *         pin every thread to the CPUs of its node, unless an affinity is
+     *         given. Tasks enqueued from outside the pool are queued on the
+     *         node of the calling CPU and preferably run by threads of that
+     *         node.
+     */
+    bool m_numaAware = false;
+
+    /**
+     *  @brief The number of times an idle pool thread looks for work with a
+     *         CPU pause in between, before yielding. Spinning avoids parking 
+     *         and waking threads for short gaps between tasks. At most half 
+     *         of the pool threads spin at the same time.
+     */
+    size_t m_idleSpinCount = 64;
+
+    /**
+     *  @brief The number of times an idle pool thread looks for work with a
+     *         yield in between, after spinning and before parking. Zero spin
+     *         and yield counts park idle threads immediately.
+     */
+    size_t m_idleYieldCount = 4;
+
+    /**
+     *  @brief The maximum number of pool threads of an elastic pool. Zero 
+     *         keeps the pool at the thread count. Elastic pools start the
+     *         thread count, add threads while queued tasks make no progress
+     *         or pool threads block, and retire idle threads again.
+     */
+    size_t m_maxThreadCount = 0;
+
+    /**
+     *  @brief The number of threads an elastic pool keeps when idle.
+     */
+    size_t m_minThreadCount = 1;
+
+    /**
+     *  @brief The time an elastic pool thread has to be idle for before it
+     *         retires.
+     */
+    std::chrono::milliseconds m_idleTimeout = std::chrono::milliseconds(1000);
+
+    /**
+     *  @brief The time queued tasks of an elastic pool may go without any
+     *         task being taken before another thread is added.
+     */
+    std::chrono::milliseconds m_queueDelay = std::chrono::milliseconds(10);
+
+    /**
+     *  @brief The number of queued tasks from which on tasks run 
+     *         asynchronously on the pool run on the calling thread instead,
+     *         before returning. Zero always queues tasks. Batches, 
+     *         continuations and resumed coroutines are always queued.
+     */
+    size_t m_inlineThreshold = 0;
+};
+
+//******************************************************************************
+// MARK: Pool Metrics
+//******************************************************************************
+
+/**
+ *  @brief A latency histogram with power of two buckets. The first bucket 
+ *         counts latencies below one microsecond, every further bucket 
+ *         latencies up to twice the bound of the previous one. The last bucket
+ *         also counts all longer latencies.
+ */
+struct LatencyHistogram
+{
+    static constexpr size_t s_bucketCount = 32;
+
+    /**
+     *  @brief Get the exclusive upper latency bound of a bucket.
+     *
+     *  @param bucket The bucket index.
+     *
+     *  @returns The upper bound.
+     */
+    static std::chrono::microseconds
+    GetUpperBound(size_t bucket) noexcept
+    {
+        return std::chrono::microseconds(std::chrono::microseconds::rep(1) << bucket);
+    }
+
+    /**
+     *  @brief Get the number of latencies counted.
+     *
+     *  @returns The latency count.
+     */
+    size_t
+    GetCount() const noexcept
+    {
+        size_t count = 0;
+
+        for (auto bucketCount : m_buckets)
+        {
+            count += bucketCount;
+        }
+
+        return count;
+    }
+
+    /**
+     *  @brief Get the upper bound of the bucket a percentile falls into.
+     *
+     *  @param percentile The percentile, between 0 and 100.
+     *
+     *  @returns The upper bound of the percentile, zero without latencies.
+     */
+    std::chrono::microseconds
+    GetPercentile(double percentile) const noexcept
+    {
+        auto count = GetCount();
+
+        if (count == 0)
+        {
+            return std::chrono::microseconds(0);
+        }
+
+        auto rank = static_cast<double>(count) * percentile / 100.0;
+        size_t seen = 0;
+
+        for (size_t i = 0; i < s_bucketCount; ++i)
+        {
+            seen += m_buckets[i];
+
+            if (seen > 0 && static_cast<double>(seen) >= rank)
+            {
+                return GetUpperBound(i);
+            }
+        }
+
+        return GetUpperBound(s_bucketCount - 1);
+    }
+
+    std::array<size_t, s_bucketCount> m_buckets = {};
+};
+
+/**
+ *  @brief A snapshot of the pool activity. Counters are totals since the pool
+ *         was created. Tasks run on the calling thread instead of the pool 
+ *         are not counted.
+ */
+struct PoolMetrics
+{
+    /**
+     *  @brief The number of tasks queued and not yet taken by a pool thread.
+     */
+    size_t m_queuedCount = 0;
+
+    /**
+     *  @brief The number of tasks queued on the pool.
+     */
+    size_t m_submittedCount = 0;
+
+    /**
+     *  @brief The number of task runs which finished without an exception.
+     */
+    size_t m_completedCount = 0;
+
+    /**
+     *  @brief The number of task runs which faulted.
+     */
+    size_t m_failedCount = 0;
+
+    /**
+     *  @brief The number of task runs which were cancelled before starting.
+     */
+    size_t m_cancelledCount = 0;
+
+    /**
+     *  @brief The number of pool threads currently running a task.
+     */
+    size_t m_busyThreadCount = 0;
+
+    /**
+     *  @brief The number of running pool threads currently looking for work.
+     */
+    size_t m_idleThreadCount = 0;
+
+    /**
+     *  @brief The total time spent running tasks, by thread index.
+     */
+    std::vector<std::chrono::nanoseconds> m_busyTimes;
+
+    /**
+     *  @brief The time tasks spent queued before a pool thread took them.
+     */
+    LatencyHistogram m_queueWaitHistogram;
+
+    /**
+     *  @brief The time tasks spent running.
+     */
+    LatencyHistogram m_runTimeHistogram;
+};
+
+//******************************************************************************
+// MARK: Pool
+//******************************************************************************
+
+/**
+ *  @brief The pool class is a thread pool running tasks. Tasks are run on the
+ *         default pool unless a pool is given when running them. Separate 
+ *         pools keep different kinds of work from starving each other.
+ *
+ *         Tasks enqueued from a pool thread without a pool, including 
+ *         continuations, stay on the pool of that thread.
+ *
+ *         Destroying a pool stops its threads. Tasks still waiting in the 
+ *         pool are not run; make sure to await them first.
+ */
+class Pool
+{
+    friend class TaskThread;
+
+public:
+
+    //**************************************************************************
+    // MARK: Constructor / Destructor
+    //**************************************************************************
+
+    /**
+     *  @brief Default constructor.
+     *
+     *  @param c_rOptions The pool options.
+     */
+    explicit Pool(const PoolOptions& c_rOptions = PoolOptions());
+
+    /**
+     *  @brief Copy constructor. Disabled for this class.
+     *
+     *  @param c_rPool Pool class source.
+     */
+    Pool(const Pool& c_rPool) = delete;
+
+    /**
+     *  @brief Default destructor. Stops the pool threads.
+     */
+    ~Pool() noexcept;
+
+    //**************************************************************************
+    // MARK: Default Pool
+    //**************************************************************************
+
+    /**
+     *  @brief Get the default pool, used by tasks run without a pool. This 
+     *         function is thread-safe.
+     *
+     *  @returns The default pool.
+     */
+    static Pool&
+    Default();
+
+    //**************************************************************************
+    // MARK: Workers
+    //**************************************************************************
+
+    static constexpr size_t s_noWorkerIndex = static_cast<size_t>(-1);
+
+    /**
+     *  @brief Get the index of the calling thread among the threads of its 
+     *         pool, from zero to below the maximum thread count of the 
+     *         pool. Use WorkerLocal for per worker state shared across 
+     *         pools. This function is thread-safe.
+     *
+     *  @returns The worker index, or s_noWorkerIndex if the calling thread is
+     *           not a pool thread.
+     */
+    static size_t
+    GetCurrentWorkerIndex() noexcept;
+
+    //**************************************************************************
+    // MARK: Getters
+    //**************************************************************************
+
+    /**
+     *  @brief Get the number of pool threads. This function is thread-safe.
+     *
+     *  @returns The number of pool threads.
+     */
+    size_t
+    GetThreadCount() const noexcept;
+
+    /**
+     *  @brief Get a snapshot of the pool activity. Counters of different
+     *         threads are read one after another, the snapshot is not atomic
+     *         as a whole. This function is thread-safe.
+     *
+     *  @returns The pool metrics.
+     */
+    PoolMetrics
+    GetMetrics() const;
+
+private:
+
+    //**************************************************************************
+    // MARK: Constructor
+    //**************************************************************************
+
+    /**
+     *  @brief Thread pool constructor. Does not take ownership.
+     *
+     *  @param rThreadPool The thread pool to use.
+     */
+    explicit Pool(ThreadPool& rThreadPool) noexcept;
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    std::unique_ptr<ThreadPool> m_pOwnedThreadPool;
+    ThreadPool* m_pThreadPool;
+};
+
+//******************************************************************************
+// MARK: Blocking Region
+//******************************************************************************
+
+/**
+ *  @brief The blocking region tells the pool of the calling thread that the
+ *         thread is about to block, for example on file access. Elastic pools
+ *         add a thread to keep the pool busy while the region exists. It has
+ *         no effect outside of pool threads. Awaiting an unfinished task 
+ *         from a pool thread is a blocking region on its own.
+ */
+class BlockingRegion
+{
+public:
+
+    //**************************************************************************
+    // MARK: Constructor / Destructor
+    //**************************************************************************
+
+    /**
+     *  @brief Default constructor. Enters the blocking region.
+     */
+    BlockingRegion() noexcept;
+
+    /**
+     *  @brief Copy constructor. Disabled for this class.
+     *
+     *  @param c_rBlockingRegion BlockingRegion class source.
+     */
+    BlockingRegion(const BlockingRegion& c_rBlockingRegion) = delete;
+
+    /**
+     *  @brief Default destructor. Leaves the blocking region.
+     */
+    ~BlockingRegion() noexcept;
+
+private:
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    ThreadPool* m_pThreadPool;
+};
+
+// Namespace
+}
+
+#endif /* libcpptask_CppTask_Pool_h */
@@ -0,0 +1,162 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef libcpptask_CppTask_Schedule_h
+#define libcpptask_CppTask_Schedule_h
+
+// STL
+#include <chrono>
+#include <memory>
+
+// External
+
+// Project
+#include "./CppTask_ITask.h"
+#include "./CppTask_MoveOnlyFunction.h"
+
+
+// Namespace
+namespace CppTask {
+
+// Forward declarations
+struct SchedulerEntry;
+
+//******************************************************************************
+// MARK: Timer Handle
+//******************************************************************************
+
+/**
+ *  @brief The timer handle refers to a scheduled function. Cancelling removes
+ *         the pending timer in constant time. Dropping the handle does not
+ *         cancel anything.
+ */
+class TimerHandle
+{
+public:
+
+    //**************************************************************************
+    // MARK: Constructor
+    //**************************************************************************
+
+    /**
+     *  @brief Default constructor. Creates a handle without a timer.
+     */
+    TimerHandle() noexcept = default;
+
+    /**
+     *  @brief Entry constructor.
+     *
+     *  @param pEntry The scheduled entry.
+     */
+    explicit TimerHandle(std::shared_ptr<SchedulerEntry> pEntry) noexcept
+    : m_pEntry(std::move(pEntry))
+    {}
+
+    //**************************************************************************
+    // MARK: Cancel
+    //**************************************************************************
+
+    /**
+     *  @brief Cancel the timer. Runs already enqueued are skipped, a run 
+     *         which already started is waited for unless cancelled from within
+     *         that run. The function never runs once cancelling returned. This
+     *         function is thread-safe.
+     *
+     *  @returns True if a future fire of the timer was prevented, false if 
+     *           not.
+     */
+    bool
+    Cancel() noexcept;
+
+    //**************************************************************************
+    // MARK: Getters
+    //**************************************************************************
+
+    /**
+     *  @brief Check if the timer runs its function again. This function is 
+     *         thread-safe.
+     *
+     *  @returns True if pending, false if not.
+     */
+    bool
+    IsPending() const noexcept;
+
+private:
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    std::shared_ptr<SchedulerEntry> m_pEntry;
+};
+
+//******************************************************************************
+// MARK: Schedule
+//******************************************************************************
+
+/**
+ *  @brief Run a function on the default pool once a delay passed. The delay
+ *         is rounded up to the timer resolution, one millisecond by default.
+ *         No thread is blocked while waiting. This function is thread-safe.
+ *
+ *  @param delay The delay to run the function after.
+ *  @param function The function to run.
+ *  @param priority The priority to run the function with.
+ *
+ *  @returns The handle to cancel the timer with.
+ */
+TimerHandle
+RunAfter(std::chrono::nanoseconds delay, 
+         MoveOnlyFunction<void()> function, 
+         TaskPriority priority = TaskPriority::NORMAL);
+
+/**
+ *  @brief Run a function on the default pool once a point in time passed. See
+ *         RunAfter().
+ *
+ *  @param deadline The point in time to run the function at.
+ *  @param function The function to run.
+ *  @param priority The priority to run the function with.
+ *
+ *  @returns The handle to cancel the timer with.
+ */
+TimerHandle
+RunAt(std::chrono::steady_clock::time_point deadline, 
+      MoveOnlyFunction<void()> function, 
+      TaskPriority priority = TaskPriority::NORMAL);
+
+/**
+ *  @brief Run a function on the default pool every period, starting one 
+ *         period from now, until cancelled. Runs are never overlapping, a 
+ *         period is skipped while the previous run is still queued or 
+ *         running. See RunAfter().
+ *
+ *  @param period The time between runs.
+ *  @param function The function to run.
+ *  @param priority The priority to run the function with.
+ *
+ *  @returns The handle to cancel the timer with.
+ */
+TimerHandle
+RunEvery(std::chrono::nanoseconds period, 
+         MoveOnlyFunction<void()> function, 
+         TaskPriority priority = TaskPriority::NORMAL);
+
+// Namespace
+}
+
+#endif /* libcpptask_CppTask_Schedule_h */
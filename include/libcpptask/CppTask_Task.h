@@ -19,34 +19,59 @@
 #define libcpptask_CppTask_Task_h
 
 // STL
-#include <any>
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <new>
+#include <string>
+#include <vector>
+#include <type_traits>
 
 // External
 
 // Project
 #include "./CppTask_ITask.h"
+#include "./CppTask_IntrusivePointer.h"
+#include "./CppTask_TaskResult.h"
+#include "./CppTask_Cancellation.h"
+#include "./CppTask_TaskAllocator.h"
+#include "./CppTask_MoveOnlyFunction.h"
 
 
 // Namespace
 namespace CppTask {
 
+// Forward declarations
+class Pool;
+class ThreadPool;
+class IO;
+
 //******************************************************************************
 // MARK: Task Implementation
 //******************************************************************************
 
 /**
  *  @brief The task thread class is responsible for running the task content
- *         on a separate thread, storing the result and setting the task state.
+ *         on a separate thread and setting the task state. Task threads are
+ *         reference counted intrusively; the task thread is the control 
+ *         block shared by all task instances and the thread pool.
  */
 class TaskThread
 {
     // We want everything hidden, except the existence of the class
-    // This thread class is meant for use by the task and thread pool class only
+    // This thread class is meant for use by the task, its control blocks and
+    // the thread pool class only
     // Sadly, It is not really possible to hide the definition completely
     template<typename T> friend class Task;
+    template<typename T> friend class TaskAwaiter;
+    template<typename T> friend class IntrusivePointer;
     friend class ThreadPool;
+    friend class Tracer;
+    friend class TaskGraph;
 
 public:
 
@@ -59,297 +84,1911 @@ public:
      */
     virtual ~TaskThread() noexcept = default;
 
-private:
-
     //**************************************************************************
-    // MARK: Constructor
+    // MARK: Allocation
     //**************************************************************************
-        
+
     /**
-     *  @brief Default constructor.
+     *  @brief Allocate a control block from the task memory resource.
+     *
+     *  @param size The control block size.
      *
-     *  @param c_rFunction The function of the task thread to run.
+     *  @returns The control block memory.
      */
-    TaskThread(const std::function<void(TaskThread& rTaskThread)>& c_rFunction);
-        
-    //**************************************************************************
-    // MARK: Run Task
-    //**************************************************************************
-    
+    static void*
+    operator new(std::size_t size)
+    {
+        return TaskAllocator::Allocate(size);
+    }
+
     /**
-     *  @brief Enqueue a task thread to be run. This function is thread-safe.
+     *  @brief Return a control block to the resource it was allocated from.
      *
-     *  @param pTaskThread The task thread to enqueue.
+     *  @param pMemory The control block memory.
+     *  @param size The control block size.
      */
     static void
-    Enqueue(std::shared_ptr<TaskThread> pTaskThread);
+    operator delete(void* pMemory, std::size_t size) noexcept
+    {
+        TaskAllocator::Deallocate(pMemory, size);
+    }
 
     /**
-     *  @brief Run the task thread with the given function. This function is
-     *         thread-safe.
+     *  @brief Allocate an over-aligned control block. Over-aligned results are
+     *         rare, such control blocks bypass the task memory resource.
+     *
+     *  @param size The control block size.
+     *  @param alignment The control block alignment.
+     *
+     *  @returns The control block memory.
      */
-    void
-    Run();
-        
+    static void*
+    operator new(std::size_t size, std::align_val_t alignment)
+    {
+        return ::operator new(size, alignment);
+    }
+
+    /**
+     *  @brief Free an over-aligned control block.
+     *
+     *  @param pMemory The control block memory.
+     *  @param size The control block size.
+     *  @param alignment The control block alignment.
+     */
+    static void
+    operator delete(void* pMemory, std::size_t size, std::align_val_t alignment) noexcept
+    {
+        ::operator delete(pMemory, size, alignment);
+    }
+
+protected:
+
     //**************************************************************************
-    // MARK: Await Task
+    // MARK: Constructor
     //**************************************************************************
-
+        
     /**
-     *  @brief Set the result of a task. This will notify all which are
-     *         waiting for the task to finish. This function is thread-safe.
+     *  @brief Default constructor.
      */
-    void
-    SetFinished();
+    TaskThread() noexcept;
 
     /**
-     *  @brief Wait for the task to be finished. This function will return 
-     *         instantly if the task already finished. This function is
-     *         thread-safe.
+     *  @brief Copy constructor. Disabled for this class.
+     *
+     *  @param c_rTaskThread TaskThread class source.
      */
-    void
-    Await() const;
+    TaskThread(const TaskThread& c_rTaskThread) = delete;
         
     //**************************************************************************
-    // MARK: Task Result
+    // MARK: Reference Count
     //**************************************************************************
 
     /**
-     *  @brief Set the result of a task. This function is thread-safe.
-     *
-     *  @param result The result value to store.
+     *  @brief Add a reference to the task thread. This function is 
+     *         thread-safe.
      */
     void
-    SetResult(std::any result);
+    AddReference() const noexcept
+    {
+        m_referenceCount.fetch_add(1, std::memory_order_relaxed);
+    }
 
     /**
-     *  @brief Retrieve the result of a task. The same result will be returned
-     *         for repeated calls. This function is thread-safe.
-     *
-     *  @returns The stored result as std::any.
+     *  @brief Release a reference to the task thread. The task thread is 
+     *         destroyed once the last reference is released. This function is
+     *         thread-safe.
      */
-    const std::any&
-    GetResult() const;
+    void
+    ReleaseReference() const noexcept
+    {
+        if (m_referenceCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            delete this;
+        }
+    }
 
     //**************************************************************************
-    // MARK: Task State
+    // MARK: Run Task
     //**************************************************************************
     
     /**
-     *  @brief Get the current task thread state. This function is thread-safe.
-     * 
-     *  @returns The current task thread state.
+     *  @brief Enqueue a task thread to be run on the pool of the calling 
+     *         thread, or the default pool if the calling thread is not a pool
+     *         thread. This function is thread-safe.
+     *
+     *  @param pTaskThread The task thread to enqueue.
      */
-    TaskState
-    GetState() const;
+    static void
+    Enqueue(IntrusivePointer<TaskThread> pTaskThread);
 
-    //**************************************************************************
-    // MARK: Task Implementation Storage Object
-    //**************************************************************************
+    /**
+     *  @brief Enqueue a task thread to be run on a pool. This function is 
+     *         thread-safe.
+     *
+     *  @param pTaskThread The task thread to enqueue.
+     *  @param rPool The pool to run the task thread on.
+     */
+    static void
+    Enqueue(IntrusivePointer<TaskThread> pTaskThread, Pool& rPool);
 
     /**
-     *  @brief The storage hides the actual content used by the task thread
-     *         implementation.
+     *  @brief Enqueue a task thread to be run on a thread pool. This function
+     *         is thread-safe.
+     *
+     *  @param pTaskThread The task thread to enqueue.
+     *  @param rThreadPool The thread pool to run the task thread on.
      */
-    struct Storage;
+    static void
+    Enqueue(IntrusivePointer<TaskThread> pTaskThread, ThreadPool& rThreadPool);
 
-    //**************************************************************************
-    // MARK: Variables
-    //**************************************************************************
+    /**
+     *  @brief Enqueue a task thread like Enqueue(), or run it on the calling
+     *         thread if the pool is saturated. Only for tasks run by the user,
+     *         continuations and other follow-up work are always enqueued so
+     *         they never nest on the stack of whoever finished before. This 
+     *         function is thread-safe.
+     *
+     *  @param pTaskThread The task thread to enqueue or run.
+     */
+    static void
+    EnqueueOrRun(IntrusivePointer<TaskThread> pTaskThread);
 
-    std::shared_ptr<Storage> m_pStorage;
-};
+    /**
+     *  @brief Enqueue a task thread to be run on a pool, or run it on the 
+     *         calling thread if the pool is saturated. See EnqueueOrRun().
+     *
+     *  @param pTaskThread The task thread to enqueue or run.
+     *  @param rPool The pool to run the task thread on.
+     */
+    static void
+    EnqueueOrRun(IntrusivePointer<TaskThread> pTaskThread, Pool& rPool);
 
-//******************************************************************************
-// MARK: Task Template
-//******************************************************************************
+    /**
+     *  @brief Enqueue a task thread to be run on a thread pool, or run it on
+     *         the calling thread if the thread pool is saturated. See 
+     *         EnqueueOrRun().
+     *
+     *  @param pTaskThread The task thread to enqueue or run.
+     *  @param rThreadPool The thread pool to run the task thread on.
+     */
+    static void
+    EnqueueOrRun(IntrusivePointer<TaskThread> pTaskThread, ThreadPool& rThreadPool);
 
-/**
- *  @brief The task class allows to run asynchronous operations. Tasks can
- *         return a result if needed. A task can only be run once, but results
- *         can be retrieved multiple times. 
- *         
- *         Task results are stored and stay available until the last task 
- *         instance has been destroyed.
- * 
- *         Make sure to capture the variables needed by the task function
- *         correctly to prevent crashes. Tasks are unable to handle exceptions 
- *         because of lambda limitations; make sure to handle exceptions in the
- *         provided task function.
- * 
- *         Tasks will keep running, even if the last held instance goes out of 
- *         scope. There is no way to cancel a task once it has been started,
- *         unless the task function includes functionality to implement such 
- *         behaviour.
- */
-template <typename T>
-class Task : public ITask<T>
-{
-public:
+    /**
+     *  @brief Enqueue task threads to be run on the pool of the calling 
+     *         thread, or the default pool if the calling thread is not a pool
+     *         thread. All task threads are checked before any is enqueued.
+     *         This function is thread-safe.
+     *
+     *  @param taskThreads The task threads to enqueue.
+     */
+    static void
+    EnqueueAll(std::vector<IntrusivePointer<TaskThread>> taskThreads);
 
-    //**************************************************************************
-    // MARK: Constructor
-    //**************************************************************************
-    
     /**
-     *  @brief Default constructor.
+     *  @brief Enqueue task threads to be run on a pool. All task threads are
+     *         checked before any is enqueued. This function is thread-safe.
      *
-     *  @param c_rTaskFunction The function of the task to run.
+     *  @param taskThreads The task threads to enqueue.
+     *  @param rPool The pool to run the task threads on.
      */
-    Task(const std::function<T()>& c_rTaskFunction)
-    : m_pTaskThread(new TaskThread([c_rTaskFunction](TaskThread& rTaskThread){
-        if constexpr (std::is_same_v<T, void>)
-        {
-            c_rTaskFunction();
-            rTaskThread.SetFinished();
-        }
-        else
-        {
-            auto result = c_rTaskFunction();
-            rTaskThread.SetResult(std::move(result));
-            rTaskThread.SetFinished();
-        }
-    }))
-    {}
-    
-    //**************************************************************************
-    // MARK: Create Completed Task
-    //**************************************************************************
-    
+    static void
+    EnqueueAll(std::vector<IntrusivePointer<TaskThread>> taskThreads, Pool& rPool);
+
     /**
-     *  @brief Create an already completed task.
+     *  @brief Enqueue task threads to be run on a thread pool. All task 
+     *         threads are checked before any is enqueued. This function is 
+     *         thread-safe.
      *
-     *  @returns The completed task.
+     *  @param taskThreads The task threads to enqueue.
+     *  @param rThreadPool The thread pool to run the task threads on.
      */
-    template <typename U = T>
-    static typename std::enable_if<std::is_void<U>::value, std::shared_ptr<Task<U>>>::type
-    CompletedTask()
-    {
-        auto pTask = std::make_shared<Task<U>>([](){});
-        pTask->m_pTaskThread->SetFinished();
+    static void
+    EnqueueAll(std::vector<IntrusivePointer<TaskThread>> taskThreads, ThreadPool& rThreadPool);
 
-        return pTask;
-    }
+    /**
+     *  @brief Enqueue a task thread once a point in time passed. Task threads
+     *         scheduled from a pool thread are enqueued to that pool, others
+     *         to the default pool. No thread waits for the deadline. This 
+     *         function is thread-safe.
+     *
+     *  @param pTaskThread The task thread to enqueue.
+     *  @param deadline The point in time to enqueue at.
+     */
+    static void
+    EnqueueAt(IntrusivePointer<TaskThread> pTaskThread, std::chrono::steady_clock::time_point deadline);
 
     /**
-     *  @brief Create an already completed task.
+     *  @brief Enqueue a task thread to be run on a pool once a point in time 
+     *         passed. This function is thread-safe.
      *
-     *  @param c_rResult The result of the completed task.
+     *  @param pTaskThread The task thread to enqueue.
+     *  @param deadline The point in time to enqueue at.
+     *  @param rPool The pool to run the task thread on.
+     */
+    static void
+    EnqueueAt(IntrusivePointer<TaskThread> pTaskThread, std::chrono::steady_clock::time_point deadline, Pool& rPool);
+
+    /**
+     *  @brief Enqueue a task thread to be run on a thread pool once a point in
+     *         time passed. This function is thread-safe.
      *
-     *  @returns The completed task.
+     *  @param pTaskThread The task thread to enqueue.
+     *  @param deadline The point in time to enqueue at.
+     *  @param rThreadPool The thread pool to run the task thread on.
      */
-    template <typename U = T>
-    static typename std::enable_if<!std::is_void<U>::value, std::shared_ptr<Task<U>>>::type
-    CompletedTask(const U& c_Result)
-    {
-        // While this function shouldn't be called since we immediately
-        // finish the task we still return a valid result. For this we capture
-        // the task itself in the task lambda. The task is known to exist as
-        // long as the lambda does, since the task owns it
-        std::shared_ptr<Task<U>> pTask = std::make_shared<Task<U>>([&pTask](){
-            return pTask->GetResult();
-        });
+    static void
+    EnqueueAt(IntrusivePointer<TaskThread> pTaskThread, 
+              std::chrono::steady_clock::time_point deadline, 
+              ThreadPool& rThreadPool);
 
-        pTask->m_pTaskThread->SetResult(c_Result);
-        pTask->m_pTaskThread->SetFinished();
+    /**
+     *  @brief Run the task thread with the given function. This function is
+     *         thread-safe.
+     *
+     *  @returns The done state this run moved the task thread into, or 
+     *           RUNNING if it is still running, like a suspended coroutine.
+     */
+    TaskState
+    Run();
 
-        return pTask;
-    }
+    /**
+     *  @brief Run the task thread on the calling thread, applying the same
+     *         checks as when enqueued. This function is thread-safe.
+     */
+    void
+    RunInline();
 
-    //**************************************************************************
-    // MARK: Run Task
-    //**************************************************************************
-    
     /**
-     *  @brief Run the task synchronously. Running the task is only possible
-     *         once. This function is thread-safe.
+     *  @brief Claim the task thread for a single run. Only one of concurrent
+     *         attempts to enqueue or run the task thread wins, the claim is 
+     *         given up again by Reset(). Throws if the task thread may not be
+     *         run or was claimed before. This function is thread-safe.
      */
     void
-    Run() override
-    {
-        RunAsync();
-        Await();
-    }
-    
+    Claim();
+
     /**
-     *  @brief Run the task asynchronously. Running the task is only possible
-     *         once. This function is thread-safe.
+     *  @brief Give up the claim of a task thread which could not be enqueued
+     *         after all. This function is thread-safe.
      */
     void
-    RunAsync() override
+    Unclaim() noexcept
     {
-        TaskThread::Enqueue(m_pTaskThread);
+        m_claimed.store(false, std::memory_order_release);
     }
-    
-    //**************************************************************************
-    // MARK: Await Task
-    //**************************************************************************
 
     /**
-     *  @brief Wait for a task to finished. This function is thread-safe.
+     *  @brief Move a done task thread back to waiting and clear its result, so
+     *         it can be run again. Throws if the task thread is running or can
+     *         not be reset. This function is thread-safe.
      */
     void
-    Await() const override
-    {
-        m_pTaskThread->Await();
-    }
+    Reset();
 
     /**
-     *  @brief Get the result of a finished task. This function is thread-safe.
+     *  @brief Check if the task thread can be reset. Task threads which run
+     *         something other than their own function can not.
      *
-     *  @returns The task result.
+     *  @returns True if the task thread can be reset, false if not.
      */
-    T
-    GetResult() const override
+    virtual bool
+    CanReset() const
     {
-        if constexpr (!std::is_same_v<T, void>)
-        {
-            return std::any_cast<T>(m_pTaskThread->GetResult());
-        }
+        return true;
     }
 
     /**
-     *  @brief Wait for a task to finish and return the task result. This 
-     *         function will return the already finished result if one exists.
-     *         The same result will be returned for repeated calls. This 
-     *         function is thread-safe.
-     *
-     *  @returns The task result.
+     *  @brief Clear the result of the task thread. The task thread mutex has
+     *         to be held, the task thread may not be running.
      */
-    T
-    AwaitResult() const override
-    {
-        Await();
+    virtual void
+    ClearResult()
+    {}
 
-        if constexpr (!std::is_same_v<T, void>)
-        {
-            return GetResult();
-        }
-    }
+    /**
+     *  @brief Execute the task function, store the result and finish the
+     *         task thread. Implemented by the typed control block.
+     */
+    virtual void
+    Execute() = 0;
 
-    //**************************************************************************
-    // MARK: Task State
-    //**************************************************************************
-    
     /**
-     *  @brief Get the current task state. This function is thread-safe.
-     * 
-     *  @returns The current task state.
+     *  @brief Check if the task thread can be enqueued. Continuations are
+     *         only ready once their parent finished.
+     *
+     *  @returns True if the task thread can be enqueued, false if not.
      */
-    TaskState
-    GetState() const override
+    virtual bool
+    IsReady() const
     {
-        return m_pTaskThread->GetState();
+        return true;
     }
-
-private:
- 
+        
     //**************************************************************************
-    // MARK: Variables
+    // MARK: Await Task
     //**************************************************************************
 
-    std::shared_ptr<TaskThread> m_pTaskThread;
-};
+    /**
+     *  @brief Set the result of a task. This will notify all which are
+     *         waiting for the task to finish. This function is thread-safe.
+     */
+    void
+    SetFinished();
+
+    /**
+     *  @brief Cancel the task thread without running it. This will notify all
+     *         which are waiting for the task to finish. This function is 
+     *         thread-safe.
+     */
+    void
+    SetCancelled();
+
+    /**
+     *  @brief Fault the task thread with an exception. This will notify all
+     *         which are waiting for the task to finish. This function is 
+     *         thread-safe.
+     *
+     *  @param pException The exception to rethrow when retrieving results.
+     */
+    void
+    SetFaulted(std::exception_ptr pException);
+
+    /**
+     *  @brief Move the task thread into a done state, unless it is done
+     *         already, and call the continuations.
+     *
+     *  @param state The done state.
+     *  @param pException The exception of a faulted task thread.
+     */
+    void
+    SetDone(TaskState state, std::exception_ptr pException = nullptr);
+
+    /**
+     *  @brief Move the task thread into a done state, unless it is done 
+     *         already.
+     *
+     *  @param state The done state.
+     *
+     *  @returns True if the state was moved, false if already done.
+     */
+    bool
+    TrySetDone(TaskState state) noexcept;
+
+    /**
+     *  @brief Wake everybody blocked on the task thread and call the 
+     *         continuations, once done. Skipped if nobody ever waited or 
+     *         added a continuation, or if a reset notified the run already.
+     *
+     *  @param generation The generation of the run which is done.
+     */
+    void
+    NotifyDone(size_t generation);
+
+    /**
+     *  @brief Get the exception of a faulted task thread without locking. 
+     *         This function is thread-safe.
+     *
+     *  @returns The exception, or nullptr if the task thread did not fault.
+     */
+    std::exception_ptr
+    GetException() const;
+
+    /**
+     *  @brief Rethrow the exception of a faulted task thread, if any, without
+     *         locking. This function is thread-safe.
+     */
+    void
+    RethrowIfFaulted() const;
+
+    /**
+     *  @brief Check if a task state is a done state.
+     *
+     *  @param state The task state to check.
+     *
+     *  @returns True if the task state is done, false if not.
+     */
+    static bool
+    IsDone(TaskState state) noexcept
+    {
+        return state == TaskState::FINISHED || 
+               state == TaskState::CANCELLED || 
+               state == TaskState::FAULTED;
+    }
+
+    /**
+     *  @brief Wait for the task to be done. This function will return 
+     *         instantly if the task is already done. This function is
+     *         thread-safe.
+     */
+    void
+    Await() const;
+
+    /**
+     *  @brief Wait for the task to be done until a point in time. This 
+     *         function is thread-safe.
+     *
+     *  @param deadline The point in time to wait until.
+     *
+     *  @returns True if the task is done, false if the wait timed out.
+     */
+    bool
+    AwaitUntil(std::chrono::steady_clock::time_point deadline) const;
+
+    /**
+     *  @brief Add a continuation to call once the task thread finished. The
+     *         continuation is called immediately if the task thread already
+     *         finished. This function is thread-safe.
+     *
+     *  @param continuation The continuation to call.
+     */
+    void
+    AddContinuation(std::function<void()> continuation);
+
+    //**************************************************************************
+    // MARK: Task State
+    //**************************************************************************
+    
+    /**
+     *  @brief Get the current task thread state without locking. This 
+     *         function is thread-safe.
+     * 
+     *  @returns The current task thread state.
+     */
+    TaskState
+    GetState() const noexcept
+    {
+        return m_state.load(std::memory_order_acquire);
+    }
+
+    //**************************************************************************
+    // MARK: Task Priority
+    //**************************************************************************
+
+    /**
+     *  @brief Set the priority to enqueue the task thread with. Has no effect
+     *         once the task thread was enqueued. This function is thread-safe.
+     *
+     *  @param priority The task thread priority.
+     */
+    void
+    SetPriority(TaskPriority priority) noexcept
+    {
+        m_priority.store(priority, std::memory_order_relaxed);
+    }
+
+    /**
+     *  @brief Get the priority of the task thread. This function is 
+     *         thread-safe.
+     *
+     *  @returns The task thread priority.
+     */
+    TaskPriority
+    GetPriority() const noexcept
+    {
+        return m_priority.load(std::memory_order_relaxed);
+    }
+
+    //**************************************************************************
+    // MARK: Cancellation
+    //**************************************************************************
+
+    /**
+     *  @brief Set the cancellation token checked before running the task 
+     *         thread. Has to be set before the task thread is enqueued or run,
+     *         running reads it without locking.
+     *
+     *  @param token The cancellation token.
+     */
+    void
+    SetCancellationToken(CancellationToken token);
+
+    //**************************************************************************
+    // MARK: Task Name
+    //**************************************************************************
+
+    /**
+     *  @brief Name the task thread in traces. Names are interned and kept 
+     *         for the lifetime of the program, use a small set of names. This
+     *         function is thread-safe.
+     *
+     *  @param c_rName The task thread name.
+     */
+    void
+    SetName(const std::string& c_rName);
+
+    /**
+     *  @brief Get the name of the task thread. This function is thread-safe.
+     *
+     *  @returns The task thread name, empty if unnamed.
+     */
+    const std::string&
+    GetName() const noexcept;
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    // Only touched once somebody blocks on the task thread or chains to it,
+    // kept away from the state and the result of the control block. The 
+    // condition is created by the first waiter
+    mutable std::mutex m_mutex;
+    mutable std::unique_ptr<std::condition_variable> m_pCondition;
+    std::vector<std::function<void()>> m_continuations;
+
+    CancellationToken m_cancellationToken;
+    std::atomic<const std::string*> m_pName;
+    std::chrono::steady_clock::time_point m_enqueueTime;
+
+    // Moved by whoever runs, finishes and polls the task thread, right before
+    // the result of the control block
+    mutable std::atomic<size_t> m_referenceCount;
+    mutable std::atomic<bool> m_hasListeners;
+    std::atomic<size_t> m_generation;
+    std::atomic<bool> m_claimed;
+    std::atomic<TaskPriority> m_priority;
+    std::atomic<TaskState> m_state;
+    std::exception_ptr m_pException;
+
+    // The task thread run by the calling thread and the done state it moved 
+    // into, read back once the run returns
+    static thread_local const TaskThread* s_pRunTaskThread;
+    static thread_local TaskState s_runState;
+};
+
+//******************************************************************************
+// MARK: Task Control Block
+//******************************************************************************
+
+/**
+ *  @brief The task control block stores the task function and the typed task
+ *         result next to the task thread state. Everything a task needs is
+ *         created with a single allocation.
+ */
+template <typename T>
+class TaskControlBlock : public TaskThread
+{
+    template<typename U> friend class Task;
+    template<typename U, typename V, typename F> friend class ContinuationControlBlock;
+    template<typename U> friend class WhenAllControlBlock;
+    template<typename U> friend class TaskAwaiter;
+
+protected:
+
+    //**************************************************************************
+    // MARK: Constructor
+    //**************************************************************************
+
+    /**
+     *  @brief Default constructor.
+     *
+     *  @param function The function of the task to run.
+     */
+    template <typename F>
+    explicit TaskControlBlock(F&& function)
+    : TaskThread(),
+      m_function(std::forward<F>(function))
+    {}
+
+    /**
+     *  @brief Constructor for derived control blocks which implement their
+     *         own Execute().
+     */
+    TaskControlBlock()
+    : TaskThread()
+    {}
+
+    //**************************************************************************
+    // MARK: Run Task
+    //**************************************************************************
+
+    /**
+     *  @brief Execute the task function, store the result and finish the
+     *         task thread.
+     */
+    void
+    Execute() override
+    {
+        if constexpr (std::is_same_v<T, void>)
+        {
+            m_function();
+        }
+        else
+        {
+            SetResult(m_function());
+        }
+
+        SetFinished();
+    }
+
+    //**************************************************************************
+    // MARK: Task Result
+    //**************************************************************************
+
+    /**
+     *  @brief Clear the stored result. The task thread mutex has to be held.
+     */
+    void
+    ClearResult() override
+    {
+        m_result.Reset();
+    }
+
+    /**
+     *  @brief Set the result of a task. Only the producer of the result calls
+     *         this, before finishing the task thread, which publishes the 
+     *         result to everybody else.
+     *
+     *  @param result The result value to store.
+     */
+    template <typename U>
+    void
+    SetResult(U&& result)
+    {
+        m_result.Set(std::forward<U>(result));
+    }
+
+    /**
+     *  @brief Check that the result of the task can be accessed. The result
+     *         is only read once the task is done, it never changes afterwards
+     *         until reset. Throws if there is no result.
+     */
+    void
+    CheckResult() const
+    {
+        auto state = GetState();
+
+        if (state == TaskState::FAULTED)
+        {
+            std::rethrow_exception(m_pException);
+        }
+        else if (!IsDone(state) || !m_result.HasValue())
+        {
+            throw Exception("No result available to return!");
+        }
+    }
+
+    /**
+     *  @brief Retrieve the result of a task. The same result will be returned
+     *         for repeated calls. This function is thread-safe.
+     *
+     *  @returns The stored result.
+     */
+    template <typename U = T>
+    const U&
+    GetResult() const
+    {
+        CheckResult();
+        return m_result.Get();
+    }
+
+    /**
+     *  @brief Move the result out of the task. Later calls to retrieve the
+     *         result will throw. Never call this while the result is still 
+     *         retrieved elsewhere.
+     *
+     *  @returns The stored result.
+     */
+    template <typename U = T>
+    U
+    TakeResult()
+    {
+        CheckResult();
+        return m_result.Take();
+    }
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    MoveOnlyFunction<T()> m_function;
+    TaskResult<T> m_result;
+};
+
+//******************************************************************************
+// MARK: Continuation Control Block
+//******************************************************************************
+
+/**
+ *  @brief The continuation control block runs a function with the result of a
+ *         parent task. It is enqueued by the parent once the parent finished,
+ *         no pool thread is blocked waiting on the parent.
+ *
+ *         The parent is only referenced once it finished, the continuation
+ *         itself is owned by the parent until then. This keeps unfinished
+ *         parents and their continuations free of reference cycles.
+ */
+template <typename T, typename U, typename F>
+class ContinuationControlBlock : public TaskControlBlock<U>
+{
+    template<typename V> friend class Task;
+
+private:
+
+    //**************************************************************************
+    // MARK: Constructor
+    //**************************************************************************
+
+    /**
+     *  @brief Default constructor.
+     *
+     *  @param function The continuation function to run.
+     */
+    template <typename G>
+    ContinuationControlBlock(G&& function)
+    : TaskControlBlock<U>(),
+      m_continuation(std::forward<G>(function))
+    {}
+
+    //**************************************************************************
+    // MARK: Run Task
+    //**************************************************************************
+
+    /**
+     *  @brief Enqueue the continuation after the parent finished.
+     *
+     *  @param pParent The finished parent.
+     */
+    void
+    Schedule(IntrusivePointer<TaskControlBlock<T>> pParent)
+    {
+        // The enqueue publishes the parent to the running thread
+        m_pParent = std::move(pParent);
+        m_isScheduled.store(true, std::memory_order_release);
+
+        try
+        {
+            TaskThread::Enqueue(IntrusivePointer<TaskThread>(this));
+        }
+        catch (const Exception&)
+        {
+            // The thread pool is stopped, there is nobody left to run us
+        }
+    }
+
+    /**
+     *  @brief Continuations run once with the result of their parent.
+     *
+     *  @returns Always false.
+     */
+    bool
+    CanReset() const override
+    {
+        return false;
+    }
+
+    /**
+     *  @brief Execute the continuation function with the parent result, store
+     *         the result and finish the task thread.
+     */
+    void
+    Execute() override
+    {
+        IntrusivePointer<TaskControlBlock<T>> pParent(nullptr);
+        pParent.swap(m_pParent);
+
+        // There is no result to continue with
+        if (pParent->GetState() == TaskState::CANCELLED)
+        {
+            this->SetCancelled();
+            return;
+        }
+        else if (pParent->GetState() == TaskState::FAULTED)
+        {
+            this->SetFaulted(pParent->GetException());
+            return;
+        }
+
+        if constexpr (std::is_void_v<T> && std::is_void_v<U>)
+        {
+            m_continuation();
+        }
+        else if constexpr (std::is_void_v<T>)
+        {
+            this->SetResult(m_continuation());
+        }
+        else if constexpr (std::is_void_v<U>)
+        {
+            m_continuation(pParent->GetResult());
+        }
+        else
+        {
+            this->SetResult(m_continuation(pParent->GetResult()));
+        }
+
+        this->SetFinished();
+    }
+
+    /**
+     *  @brief Check if the continuation can be enqueued.
+     *
+     *  @returns True once the parent finished, false before.
+     */
+    bool
+    IsReady() const override
+    {
+        return m_isScheduled.load(std::memory_order_acquire);
+    }
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    F m_continuation;
+    IntrusivePointer<TaskControlBlock<T>> m_pParent;
+    std::atomic<bool> m_isScheduled { false };
+};
+
+//******************************************************************************
+// MARK: Completion Control Block
+//******************************************************************************
+
+/**
+ *  @brief The completion control block has no function to run. It is 
+ *         finished directly by whoever produces the result, for example once
+ *         a set of other tasks finished.
+ */
+template <typename T>
+class CompletionControlBlock : public TaskControlBlock<T>
+{
+    template<typename U> friend class Task;
+
+protected:
+
+    //**************************************************************************
+    // MARK: Constructor
+    //**************************************************************************
+
+    /**
+     *  @brief Default constructor.
+     */
+    CompletionControlBlock()
+    : TaskControlBlock<T>()
+    {}
+
+    //**************************************************************************
+    // MARK: Run Task
+    //**************************************************************************
+
+    /**
+     *  @brief Never called, completion control blocks are never enqueued.
+     */
+    void
+    Execute() override
+    {}
+
+    /**
+     *  @brief Check if the completion can be enqueued.
+     *
+     *  @returns Always false, the completion is finished by its producer.
+     */
+    bool
+    IsReady() const override
+    {
+        return false;
+    }
+
+    /**
+     *  @brief Completions are finished once by their producer.
+     *
+     *  @returns Always false.
+     */
+    bool
+    CanReset() const override
+    {
+        return false;
+    }
+};
+
+//******************************************************************************
+// MARK: When All Control Block
+//******************************************************************************
+
+/**
+ *  @brief The result type of waiting for all tasks of a result type.
+ */
+template <typename T>
+using WhenAllResult = std::conditional_t<std::is_void_v<T>, void, std::vector<T>>;
+
+/**
+ *  @brief The when all control block finishes once all tasks it was created
+ *         for finished. Every task reports its result when finishing and 
+ *         counts down, the last task to finish completes the control block.
+ *         The tasks are not referenced, so unfinished tasks can be released.
+ */
+template <typename T>
+class WhenAllControlBlock : public CompletionControlBlock<WhenAllResult<T>>
+{
+    template<typename U> friend class Task;
+
+private:
+
+    //**************************************************************************
+    // MARK: Constructor
+    //**************************************************************************
+
+    /**
+     *  @brief Default constructor.
+     *
+     *  @param count The number of tasks to wait for.
+     */
+    WhenAllControlBlock(size_t count)
+    : CompletionControlBlock<WhenAllResult<T>>(),
+      m_remaining(count),
+      m_results(std::is_void_v<T> ? 0 : count)
+    {}
+
+    //**************************************************************************
+    // MARK: Complete
+    //**************************************************************************
+
+    /**
+     *  @brief Report a finished task. A cancelled or faulted task cancels or
+     *         faults the control block immediately, the first one wins. This
+     *         function is thread-safe.
+     *
+     *  @param index The index of the finished task.
+     *  @param c_rTask The finished task.
+     */
+    template <typename U>
+    void
+    Complete(size_t index, const U& c_rTask)
+    {
+        auto state = c_rTask.GetState();
+
+        if (state == TaskState::CANCELLED)
+        {
+            this->SetCancelled();
+        }
+        else if (state == TaskState::FAULTED)
+        {
+            this->SetFaulted(CaptureException(c_rTask));
+        }
+        else if constexpr (!std::is_void_v<T>)
+        {
+            // Every task writes its own slot, the countdown publishes them
+            m_results[index].Set(c_rTask.GetResult());
+        }
+
+        // Slots of cancelled or faulted tasks are empty, there is no result
+        if (m_remaining.fetch_sub(1, std::memory_order_acq_rel) != 1 ||
+            TaskThread::IsDone(this->GetState()))
+        {
+            return;
+        }
+
+        if constexpr (!std::is_void_v<T>)
+        {
+            std::vector<T> results;
+            results.reserve(m_results.size());
+
+            for (auto& rResult : m_results)
+            {
+                results.emplace_back(rResult.Take());
+            }
+
+            this->SetResult(std::move(results));
+        }
+
+        this->SetFinished();
+    }
+
+    /**
+     *  @brief Get the exception of a faulted task.
+     *
+     *  @param c_rTask The faulted task.
+     *
+     *  @returns The exception of the task.
+     */
+    template <typename U>
+    static std::exception_ptr
+    CaptureException(const U& c_rTask)
+    {
+        if constexpr (std::is_base_of_v<TaskThread, U>)
+        {
+            return c_rTask.GetException();
+        }
+        else
+        {
+            // Other task implementations only hand out their exception by
+            // rethrowing it
+            try
+            {
+                c_rTask.GetResult();
+            }
+            catch (...)
+            {
+                return std::current_exception();
+            }
+
+            return nullptr;
+        }
+    }
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    std::atomic<size_t> m_remaining;
+    std::vector<TaskResult<T>> m_results;
+};
+
+//******************************************************************************
+// MARK: When Any Control Block
+//******************************************************************************
+
+/**
+ *  @brief The when any control block finishes with the index of the first 
+ *         task to finish. The tasks are not referenced, so unfinished tasks 
+ *         can be released.
+ */
+class WhenAnyControlBlock : public CompletionControlBlock<size_t>
+{
+    template<typename U> friend class Task;
+
+private:
+
+    //**************************************************************************
+    // MARK: Constructor
+    //**************************************************************************
+
+    /**
+     *  @brief Default constructor.
+     */
+    WhenAnyControlBlock()
+    : CompletionControlBlock<size_t>(),
+      m_isCompleted(false)
+    {}
+
+    //**************************************************************************
+    // MARK: Complete
+    //**************************************************************************
+
+    /**
+     *  @brief Report a finished task. Only the first report is used. This 
+     *         function is thread-safe.
+     *
+     *  @param index The index of the finished task.
+     */
+    void
+    Complete(size_t index)
+    {
+        if (!m_isCompleted.exchange(true, std::memory_order_acq_rel))
+        {
+            SetResult(index);
+            SetFinished();
+        }
+    }
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    std::atomic<bool> m_isCompleted;
+};
+
+//******************************************************************************
+// MARK: Continuation Result
+//******************************************************************************
+
+/**
+ *  @brief The result type of a continuation function for a task result type.
+ */
+template <typename T, typename F>
+struct ContinuationResultType
+{
+    using type = std::invoke_result_t<F, const T&>;
+};
+
+template <typename F>
+struct ContinuationResultType<void, F>
+{
+    using type = std::invoke_result_t<F>;
+};
+
+template <typename T, typename F>
+using ContinuationResult = typename ContinuationResultType<T, std::decay_t<F>>::type;
+
+//******************************************************************************
+// MARK: Task Template
+//******************************************************************************
+
+/**
+ *  @brief The task class allows to run asynchronous operations. Tasks can
+ *         return a result if needed. A task can only be run once, but results
+ *         can be retrieved multiple times. 
+ *         
+ *         Task results are stored and stay available until the last task 
+ *         instance has been destroyed.
+ * 
+ *         Make sure to capture the variables needed by the task function
+ *         correctly to prevent crashes. Exceptions thrown by the task function
+ *         fault the task, they are rethrown when retrieving the result.
+ * 
+ *         Tasks will keep running, even if the last held instance goes out of 
+ *         scope. Tasks created with a cancellation token are cancelled 
+ *         instead of run if the token is cancelled before they start. Once
+ *         started, the task function has to check the token itself.
+ */
+template <typename T>
+class Task : public ITask<T>
+{
+    template<typename U> friend class Task;
+    template<typename U> friend class TaskAwaiter;
+    template<typename U> friend class TaskPromiseBase;
+    friend class IO;
+
+public:
+
+    //**************************************************************************
+    // MARK: Constructor
+    //**************************************************************************
+    
+    /**
+     *  @brief Default constructor. The task function is forwarded into the
+     *         task once, so move-only callables are accepted and moved
+     *         callables are never copied. Small callables are stored without
+     *         a separate allocation.
+     *
+     *  @param taskFunction The function of the task to run.
+     *  @param priority The priority to run the task with.
+     */
+    template <typename F, typename = std::enable_if_t<std::is_invocable_r_v<T, std::decay_t<F>&>>>
+    Task(F&& taskFunction, TaskPriority priority = TaskPriority::NORMAL)
+    : m_pTaskThread(new TaskControlBlock<T>(std::forward<F>(taskFunction)))
+    {
+        m_pTaskThread->SetPriority(priority);
+    }
+
+    /**
+     *  @brief Cancellable constructor. The task is cancelled instead of run
+     *         if the token is cancelled once the task is about to start. The
+     *         task function has to check the token itself while running.
+     *
+     *  @param taskFunction The function of the task to run.
+     *  @param token The cancellation token of the task.
+     *  @param priority The priority to run the task with.
+     */
+    template <typename F, typename = std::enable_if_t<std::is_invocable_r_v<T, std::decay_t<F>&>>>
+    Task(F&& taskFunction, 
+         CancellationToken token, 
+         TaskPriority priority = TaskPriority::NORMAL)
+    : Task(std::forward<F>(taskFunction), priority)
+    {
+        m_pTaskThread->SetCancellationToken(std::move(token));
+    }
+    
+    //**************************************************************************
+    // MARK: Create Completed Task
+    //**************************************************************************
+    
+    /**
+     *  @brief Create an already completed task.
+     *
+     *  @returns The completed task.
+     */
+    template <typename U = T>
+    static typename std::enable_if<std::is_void<U>::value, std::shared_ptr<Task<U>>>::type
+    CompletedTask()
+    {
+        auto pTask = std::make_shared<Task<U>>([](){});
+        pTask->m_pTaskThread->SetFinished();
+
+        return pTask;
+    }
+
+    /**
+     *  @brief Create an already completed task.
+     *
+     *  @param c_rResult The result of the completed task.
+     *
+     *  @returns The completed task.
+     */
+    template <typename U = T>
+    static typename std::enable_if<!std::is_void<U>::value, std::shared_ptr<Task<U>>>::type
+    CompletedTask(const U& c_Result)
+    {
+        // The function only runs once the task is reset and run again, it 
+        // returns the same result then
+        auto pTask = std::make_shared<Task<U>>([c_Result](){
+            return c_Result;
+        });
+
+        pTask->m_pTaskThread->SetResult(c_Result);
+        pTask->m_pTaskThread->SetFinished();
+
+        return pTask;
+    }
+
+    //**************************************************************************
+    // MARK: Combine Tasks
+    //**************************************************************************
+
+    /**
+     *  @brief Create a task which finishes once all given tasks finished. The
+     *         result holds the task results in the order of the given tasks.
+     *         No thread is blocked waiting, the last task to finish completes
+     *         the returned task. The returned task can not be run manually.
+     *
+     *  @param c_rTasks The tasks to wait for.
+     *
+     *  @returns The combined task.
+     */
+    static std::shared_ptr<Task<WhenAllResult<T>>>
+    WhenAll(const std::vector<std::shared_ptr<ITask<T>>>& c_rTasks)
+    {
+        IntrusivePointer<WhenAllControlBlock<T>> pWhenAll(new WhenAllControlBlock<T>(c_rTasks.size()));
+        auto pResult = std::shared_ptr<Task<WhenAllResult<T>>>(new Task<WhenAllResult<T>>(pWhenAll));
+
+        if (c_rTasks.empty())
+        {
+            if constexpr (!std::is_void_v<T>)
+            {
+                pWhenAll->SetResult(std::vector<T>());
+            }
+
+            pWhenAll->SetFinished();
+        }
+
+        for (size_t i = 0; i < c_rTasks.size(); ++i)
+        {
+            OnFinished(c_rTasks[i], [pWhenAll, i](const auto& c_rTask){
+                pWhenAll->Complete(i, c_rTask);
+            });
+        }
+
+        return pResult;
+    }
+
+    /**
+     *  @brief Create a task which finishes once any of the given tasks 
+     *         finished. The result is the index of the first task to finish.
+     *         No thread is blocked waiting. The returned task can not be run 
+     *         manually.
+     *
+     *  @param c_rTasks The tasks to wait for. Has to contain a task.
+     *
+     *  @returns The combined task.
+     */
+    static std::shared_ptr<Task<size_t>>
+    WhenAny(const std::vector<std::shared_ptr<ITask<T>>>& c_rTasks)
+    {
+        if (c_rTasks.empty())
+        {
+            throw Exception("Invalid parameters!");
+        }
+
+        IntrusivePointer<WhenAnyControlBlock> pWhenAny(new WhenAnyControlBlock());
+        auto pResult = std::shared_ptr<Task<size_t>>(new Task<size_t>(pWhenAny));
+
+        for (size_t i = 0; i < c_rTasks.size(); ++i)
+        {
+            OnFinished(c_rTasks[i], [pWhenAny, i](const auto&){
+                pWhenAny->Complete(i);
+            });
+        }
+
+        return pResult;
+    }
+
+    //**************************************************************************
+    // MARK: Run Task
+    //**************************************************************************
+    
+    /**
+     *  @brief Run the task synchronously on the calling thread, without a
+     *         round trip through a pool. The task passes through the same
+     *         states as when run asynchronously. Running the task is only 
+     *         possible once. This function is thread-safe.
+     */
+    void
+    Run() override
+    {
+        m_pTaskThread->RunInline();
+        Await();
+    }
+    
+    /**
+     *  @brief Run the task asynchronously. Tasks run from a pool thread stay
+     *         on that pool, tasks run from other threads use the default
+     *         pool. Running the task is only possible once. This function is 
+     *         thread-safe.
+     */
+    void
+    RunAsync() override
+    {
+        TaskThread::EnqueueOrRun(m_pTaskThread);
+    }
+
+    /**
+     *  @brief Run the task asynchronously on a pool. Running the task is only
+     *         possible once. This function is thread-safe.
+     *
+     *  @param rPool The pool to run the task on.
+     */
+    void
+    RunAsync(Pool& rPool)
+    {
+        TaskThread::EnqueueOrRun(m_pTaskThread, rPool);
+    }
+
+    /**
+     *  @brief Run the task asynchronously with a priority, replacing the 
+     *         priority the task was created with. Running the task is only 
+     *         possible once. This function is thread-safe.
+     *
+     *  @param priority The priority to run the task with.
+     */
+    void
+    RunAsync(TaskPriority priority)
+    {
+        m_pTaskThread->SetPriority(priority);
+        RunAsync();
+    }
+
+    /**
+     *  @brief Run the task asynchronously on a pool with a priority, replacing
+     *         the priority the task was created with. Running the task is only
+     *         possible once. This function is thread-safe.
+     *
+     *  @param rPool The pool to run the task on.
+     *  @param priority The priority to run the task with.
+     */
+    void
+    RunAsync(Pool& rPool, TaskPriority priority)
+    {
+        m_pTaskThread->SetPriority(priority);
+        RunAsync(rPool);
+    }
+
+    /**
+     *  @brief Run the task asynchronously once a delay passed. The delay is
+     *         rounded up to the timer resolution. No thread is blocked while
+     *         waiting, the task stays waiting until then. Tasks run from a 
+     *         pool thread stay on that pool, tasks run from other threads use
+     *         the default pool. Running the task is only possible once. This
+     *         function is thread-safe.
+     *
+     *  @param c_rDelay The delay to run the task after.
+     */
+    template <typename Rep, typename Period>
+    void
+    RunAfter(const std::chrono::duration<Rep, Period>& c_rDelay)
+    {
+        RunAt(std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(c_rDelay));
+    }
+
+    /**
+     *  @brief Run the task asynchronously on a pool once a delay passed. The
+     *         task is cancelled if the pool is destroyed before, and faulted
+     *         if the pool rejects it. See RunAfter().
+     *
+     *  @param c_rDelay The delay to run the task after.
+     *  @param rPool The pool to run the task on.
+     */
+    template <typename Rep, typename Period>
+    void
+    RunAfter(const std::chrono::duration<Rep, Period>& c_rDelay, Pool& rPool)
+    {
+        RunAt(std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(c_rDelay), rPool);
+    }
+
+    /**
+     *  @brief Run the task asynchronously once a point in time passed. See
+     *         RunAfter().
+     *
+     *  @param deadline The point in time to run the task at.
+     */
+    void
+    RunAt(std::chrono::steady_clock::time_point deadline)
+    {
+        TaskThread::EnqueueAt(m_pTaskThread, deadline);
+    }
+
+    /**
+     *  @brief Run the task asynchronously on a pool once a point in time 
+     *         passed. See RunAfter().
+     *
+     *  @param deadline The point in time to run the task at.
+     *  @param rPool The pool to run the task on.
+     */
+    void
+    RunAt(std::chrono::steady_clock::time_point deadline, Pool& rPool)
+    {
+        TaskThread::EnqueueAt(m_pTaskThread, deadline, rPool);
+    }
+    
+    /**
+     *  @brief Run tasks asynchronously as a single batch, which is cheaper 
+     *         than running every task on its own. Tasks run from a pool thread
+     *         stay on that pool, tasks run from other threads use the default
+     *         pool. All tasks are checked before any is run. This function is
+     *         thread-safe.
+     *
+     *  @param rTasks The tasks to run.
+     */
+    static void
+    RunAllAsync(std::vector<Task<T>>& rTasks)
+    {
+        TaskThread::EnqueueAll(GetTaskThreads(rTasks));
+    }
+
+    /**
+     *  @brief Run tasks asynchronously on a pool as a single batch. All tasks
+     *         are checked before any is run. This function is thread-safe.
+     *
+     *  @param rTasks The tasks to run.
+     *  @param rPool The pool to run the tasks on.
+     */
+    static void
+    RunAllAsync(std::vector<Task<T>>& rTasks, Pool& rPool)
+    {
+        TaskThread::EnqueueAll(GetTaskThreads(rTasks), rPool);
+    }
+
+    /**
+     *  @brief Run tasks asynchronously as a single batch. See 
+     *         RunAllAsync(std::vector<Task<T>>&).
+     *
+     *  @param c_rTasks The tasks to run.
+     */
+    static void
+    RunAllAsync(const std::vector<std::shared_ptr<Task<T>>>& c_rTasks)
+    {
+        TaskThread::EnqueueAll(GetTaskThreads(c_rTasks));
+    }
+
+    /**
+     *  @brief Run tasks asynchronously on a pool as a single batch. See
+     *         RunAllAsync(std::vector<Task<T>>&, Pool&).
+     *
+     *  @param c_rTasks The tasks to run.
+     *  @param rPool The pool to run the tasks on.
+     */
+    static void
+    RunAllAsync(const std::vector<std::shared_ptr<Task<T>>>& c_rTasks, Pool& rPool)
+    {
+        TaskThread::EnqueueAll(GetTaskThreads(c_rTasks), rPool);
+    }
+    
+    //**************************************************************************
+    // MARK: Continuation
+    //**************************************************************************
+
+    /**
+     *  @brief Create a continuation task which runs the given function with 
+     *         the result of this task. The continuation is enqueued 
+     *         automatically once this task finished, no thread is blocked 
+     *         waiting. The continuation is enqueued immediately if this task 
+     *         already finished. The continuation can not be run manually and
+     *         runs with the priority this task has when calling this function.
+     *         This function is thread-safe.
+     *
+     *  @param function The continuation function. Takes the task result, or
+     *                  nothing for void tasks.
+     *
+     *  @returns The continuation task.
+     */
+    template <typename F>
+    std::shared_ptr<Task<ContinuationResult<T, F>>>
+    Then(F&& function)
+    {
+        using U = ContinuationResult<T, F>;
+        using Continuation = ContinuationControlBlock<T, U, std::decay_t<F>>;
+
+        IntrusivePointer<Continuation> pContinuation(new Continuation(std::forward<F>(function)));
+        auto pTask = std::shared_ptr<Task<U>>(new Task<U>(pContinuation));
+
+        pContinuation->SetPriority(m_pTaskThread->GetPriority());
+
+        // The parent is alive whenever one of its continuations is called,
+        // a non-owning pointer avoids a parent <-> continuation cycle
+        TaskControlBlock<T>* pParent = m_pTaskThread.get();
+
+        m_pTaskThread->AddContinuation([pContinuation, pParent](){
+            pContinuation->Schedule(IntrusivePointer<TaskControlBlock<T>>(pParent));
+        });
+
+        return pTask;
+    }
+
+    //**************************************************************************
+    // MARK: Await Task
+    //**************************************************************************
+
+    /**
+     *  @brief Wait for a task to finished. This function is thread-safe.
+     */
+    void
+    Await() const override
+    {
+        m_pTaskThread->Await();
+    }
+
+    /**
+     *  @brief Wait for a task to be done for at most a duration. This 
+     *         function is thread-safe.
+     *
+     *  @param timeout The maximum duration to wait for.
+     *
+     *  @returns True if the task is done, false if the wait timed out.
+     */
+    bool
+    AwaitFor(std::chrono::nanoseconds timeout) const override
+    {
+        return m_pTaskThread->AwaitUntil(std::chrono::steady_clock::now() + timeout);
+    }
+
+    /**
+     *  @brief Wait for a task to be done until a point in time. This function 
+     *         is thread-safe.
+     *
+     *  @param deadline The point in time to wait until.
+     *
+     *  @returns True if the task is done, false if the wait timed out.
+     */
+    bool
+    AwaitUntil(std::chrono::steady_clock::time_point deadline) const override
+    {
+        return m_pTaskThread->AwaitUntil(deadline);
+    }
+
+    /**
+     *  @brief Get the result of a finished task. This function is thread-safe.
+     *
+     *  @returns The task result.
+     */
+    T
+    GetResult() const override
+    {
+        if constexpr (!std::is_same_v<T, void>)
+        {
+            return m_pTaskThread->GetResult();
+        }
+        else
+        {
+            m_pTaskThread->RethrowIfFaulted();
+        }
+    }
+
+    /**
+     *  @brief Get a reference to the result of a finished task, without
+     *         copying it. The reference stays valid as long as the task 
+     *         instance exists and the result is not taken. This function is
+     *         thread-safe.
+     *
+     *  @returns The task result reference.
+     */
+    TaskResultReference<T>
+    GetResultRef() const override
+    {
+        if constexpr (!std::is_same_v<T, void>)
+        {
+            return m_pTaskThread->GetResult();
+        }
+        else
+        {
+            m_pTaskThread->RethrowIfFaulted();
+        }
+    }
+
+    /**
+     *  @brief Move the result out of a finished task, without copying it. 
+     *         The result is no longer available to any task instance 
+     *         afterwards. This function is thread-safe.
+     *
+     *  @returns The task result.
+     */
+    T
+    TakeResult() && override
+    {
+        if constexpr (!std::is_same_v<T, void>)
+        {
+            return m_pTaskThread->TakeResult();
+        }
+        else
+        {
+            m_pTaskThread->RethrowIfFaulted();
+        }
+    }
+
+    /**
+     *  @brief Wait for a task to finish and return the task result. This 
+     *         function will return the already finished result if one exists.
+     *         The same result will be returned for repeated calls. This 
+     *         function is thread-safe.
+     *
+     *  @returns The task result.
+     */
+    T
+    AwaitResult() const override
+    {
+        Await();
+
+        return GetResult();
+    }
+
+    //**************************************************************************
+    // MARK: Task State
+    //**************************************************************************
+    
+    /**
+     *  @brief Get the current task state. This function is thread-safe.
+     * 
+     *  @returns The current task state.
+     */
+    TaskState
+    GetState() const override
+    {
+        return m_pTaskThread->GetState();
+    }
+
+    /**
+     *  @brief Check if the task is done, either finished, cancelled or
+     *         faulted, without blocking or locking. This function is 
+     *         thread-safe.
+     * 
+     *  @returns True if the task is done, false if not.
+     */
+    bool
+    IsFinished() const override
+    {
+        return TaskThread::IsDone(m_pTaskThread->GetState());
+    }
+
+    //**************************************************************************
+    // MARK: Reset Task
+    //**************************************************************************
+
+    /**
+     *  @brief Reset a done task to waiting and clear its result, so it can be
+     *         run again. The task function and all allocations are reused. 
+     *         Throws if the task is running, or is a continuation, combined or
+     *         coroutine task. This function is thread-safe.
+     */
+    void
+    Reset()
+    {
+        m_pTaskThread->Reset();
+    }
+
+    //**************************************************************************
+    // MARK: Task Name
+    //**************************************************************************
+
+    /**
+     *  @brief Name the task, the name shows up in exported traces. Names are
+     *         interned and kept for the lifetime of the program, use a small
+     *         set of names like the kind of work done. This function is 
+     *         thread-safe.
+     *
+     *  @param c_rName The task name.
+     */
+    void
+    SetName(const std::string& c_rName)
+    {
+        m_pTaskThread->SetName(c_rName);
+    }
+
+    /**
+     *  @brief Get the name of the task. This function is thread-safe.
+     *
+     *  @returns The task name, empty if unnamed.
+     */
+    const std::string&
+    GetName() const noexcept
+    {
+        return m_pTaskThread->GetName();
+    }
+
+private:
+
+    //**************************************************************************
+    // MARK: Constructor
+    //**************************************************************************
+
+    /**
+     *  @brief Control block constructor.
+     *
+     *  @param pTaskThread The control block of the task.
+     */
+    Task(IntrusivePointer<TaskControlBlock<T>> pTaskThread)
+    : m_pTaskThread(std::move(pTaskThread))
+    {}
+
+    //**************************************************************************
+    // MARK: Run Task
+    //**************************************************************************
+
+    /**
+     *  @brief Get the task threads of tasks.
+     *
+     *  @param c_rTasks The tasks.
+     *
+     *  @returns The task threads.
+     */
+    static std::vector<IntrusivePointer<TaskThread>>
+    GetTaskThreads(const std::vector<Task<T>>& c_rTasks)
+    {
+        std::vector<IntrusivePointer<TaskThread>> taskThreads;
+        taskThreads.reserve(c_rTasks.size());
+
+        for (const auto& c_rTask : c_rTasks)
+        {
+            taskThreads.emplace_back(c_rTask.m_pTaskThread);
+        }
+
+        return taskThreads;
+    }
+
+    /**
+     *  @brief Get the task threads of tasks.
+     *
+     *  @param c_rTasks The tasks. Null tasks are rejected.
+     *
+     *  @returns The task threads.
+     */
+    static std::vector<IntrusivePointer<TaskThread>>
+    GetTaskThreads(const std::vector<std::shared_ptr<Task<T>>>& c_rTasks)
+    {
+        std::vector<IntrusivePointer<TaskThread>> taskThreads;
+        taskThreads.reserve(c_rTasks.size());
+
+        for (const auto& c_rpTask : c_rTasks)
+        {
+            if (!c_rpTask)
+            {
+                throw Exception("Invalid parameters!");
+            }
+
+            taskThreads.emplace_back(c_rpTask->m_pTaskThread);
+        }
+
+        return taskThreads;
+    }
+
+    //**************************************************************************
+    // MARK: Combine Tasks
+    //**************************************************************************
+
+    /**
+     *  @brief Call a function once a task finished. The function receives 
+     *         something providing GetResult() for the finished task.
+     *
+     *         Tasks of this class are observed through their control block
+     *         without blocking. Other task interface implementations are 
+     *         awaited on a pool thread instead.
+     *
+     *  @param c_rpTask The task to observe.
+     *  @param function The function to call.
+     */
+    template <typename F>
+    static void
+    OnFinished(const std::shared_ptr<ITask<T>>& c_rpTask, F function)
+    {
+        if (!c_rpTask)
+        {
+            throw Exception("Invalid parameters!");
+        }
+
+        if (auto pTask = dynamic_cast<Task<T>*>(c_rpTask.get()))
+        {
+            // The task is alive whenever one of its continuations is called
+            TaskControlBlock<T>* pTaskThread = pTask->m_pTaskThread.get();
+
+            pTaskThread->AddContinuation([pTaskThread, function](){
+                function(*pTaskThread);
+            });
+        }
+        else
+        {
+            auto pAwaitTask = std::make_shared<Task<void>>([c_rpTask, function](){
+                c_rpTask->Await();
+                function(*c_rpTask);
+            });
+
+            pAwaitTask->RunAsync();
+        }
+    }
+ 
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    IntrusivePointer<TaskControlBlock<T>> m_pTaskThread;
+};
+
+//******************************************************************************
+// MARK: Run Tasks
+//******************************************************************************
+
+/**
+ *  @brief Run tasks asynchronously as a single batch. See 
+ *         Task<T>::RunAllAsync().
+ *
+ *  @param rTasks The tasks to run.
+ */
+template <typename T>
+void
+RunAllAsync(std::vector<Task<T>>& rTasks)
+{
+    Task<T>::RunAllAsync(rTasks);
+}
+
+/**
+ *  @brief Run tasks asynchronously on a pool as a single batch. See 
+ *         Task<T>::RunAllAsync().
+ *
+ *  @param rTasks The tasks to run.
+ *  @param rPool The pool to run the tasks on.
+ */
+template <typename T>
+void
+RunAllAsync(std::vector<Task<T>>& rTasks, Pool& rPool)
+{
+    Task<T>::RunAllAsync(rTasks, rPool);
+}
+
+/**
+ *  @brief Run tasks asynchronously as a single batch. See 
+ *         Task<T>::RunAllAsync().
+ *
+ *  @param c_rTasks The tasks to run.
+ */
+template <typename T>
+void
+RunAllAsync(const std::vector<std::shared_ptr<Task<T>>>& c_rTasks)
+{
+    Task<T>::RunAllAsync(c_rTasks);
+}
+
+/**
+ *  @brief Run tasks asynchronously on a pool as a single batch. See 
+ *         Task<T>::RunAllAsync().
+ *
+ *  @param c_rTasks The tasks to run.
+ *  @param rPool The pool to run the tasks on.
+ */
+template <typename T>
+void
+RunAllAsync(const std::vector<std::shared_ptr<Task<T>>>& c_rTasks, Pool& rPool)
+{
+    Task<T>::RunAllAsync(c_rTasks, rPool);
+}
+
+//******************************************************************************
+// MARK: Combine Tasks
+//******************************************************************************
+
+/**
+ *  @brief Create a task which finishes once all given tasks finished. See
+ *         Task<T>::WhenAll().
+ *
+ *  @param c_rTasks The tasks to wait for.
+ *
+ *  @returns The combined task.
+ */
+template <typename T>
+std::shared_ptr<Task<WhenAllResult<T>>>
+WhenAll(const std::vector<std::shared_ptr<ITask<T>>>& c_rTasks)
+{
+    return Task<T>::WhenAll(c_rTasks);
+}
+
+/**
+ *  @brief Create a task which finishes once any of the given tasks finished.
+ *         See Task<T>::WhenAny().
+ *
+ *  @param c_rTasks The tasks to wait for.
+ *
+ *  @returns The combined task.
+ */
+template <typename T>
+std::shared_ptr<Task<size_t>>
+WhenAny(const std::vector<std::shared_ptr<ITask<T>>>& c_rTasks)
+{
+    return Task<T>::WhenAny(c_rTasks);
+}
 
 // Namespace
 }
@@ -0,0 +1,111 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef libcpptask_CppTask_TaskAllocator_h
+#define libcpptask_CppTask_TaskAllocator_h
+
+// STL
+#include <cstddef>
+#include <memory_resource>
+
+// External
+
+// Project
+
+
+// Namespace
+namespace CppTask {
+
+/**
+ *  @brief The task allocator provides the memory of task control blocks, the
+ *         single allocation behind every task, continuation and graph node. 
+ *         Control blocks are allocated from the task memory resource, which
+ *         is the global new and delete unless replaced.
+ *
+ *         The thread cache resource keeps freed blocks of common control 
+ *         block sizes in a free list of the freeing thread and hands them out
+ *         again before asking the global new. Tasks created and destroyed on
+ *         the same threads over and over stop allocating altogether.
+ *
+ *         Every block remembers the resource it came from, replacing the 
+ *         resource while tasks exist is safe.
+ */
+class TaskAllocator
+{
+public:
+
+    //**************************************************************************
+    // MARK: Memory Resource
+    //**************************************************************************
+
+    /**
+     *  @brief Set the memory resource to allocate control blocks from. The 
+     *         resource has to outlive every task allocated from it. This 
+     *         function is thread-safe.
+     *
+     *  @param pResource The memory resource, or nullptr for the global new
+     *                   and delete.
+     */
+    static void
+    SetMemoryResource(std::pmr::memory_resource* pResource) noexcept;
+
+    /**
+     *  @brief Get the memory resource control blocks are allocated from. This
+     *         function is thread-safe.
+     *
+     *  @returns The memory resource.
+     */
+    static std::pmr::memory_resource*
+    GetMemoryResource() noexcept;
+
+    /**
+     *  @brief Get the thread cache resource, keeping free lists of control 
+     *         block sized blocks per thread. This function is thread-safe.
+     *
+     *  @returns The thread cache resource.
+     */
+    static std::pmr::memory_resource*
+    ThreadCache() noexcept;
+
+    //**************************************************************************
+    // MARK: Allocate
+    //**************************************************************************
+
+    /**
+     *  @brief Allocate a control block from the memory resource.
+     *
+     *  @param size The control block size.
+     *
+     *  @returns The control block memory.
+     */
+    static void*
+    Allocate(std::size_t size);
+
+    /**
+     *  @brief Return a control block to the memory resource it came from.
+     *
+     *  @param pMemory The control block memory.
+     *  @param size The control block size.
+     */
+    static void
+    Deallocate(void* pMemory, std::size_t size) noexcept;
+};
+
+// Namespace
+}
+
+#endif /* libcpptask_CppTask_TaskAllocator_h */
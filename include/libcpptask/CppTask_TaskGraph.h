@@ -0,0 +1,372 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef libcpptask_CppTask_TaskGraph_h
+#define libcpptask_CppTask_TaskGraph_h
+
+// STL
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+// External
+
+// Project
+#include "./CppTask_Task.h"
+#include "./CppTask_Pool.h"
+#include "./CppTask_MoveOnlyFunction.h"
+
+
+// Namespace
+namespace CppTask {
+
+// Forward declarations
+class TaskGraph;
+
+//******************************************************************************
+// MARK: Graph Node Control Block
+//******************************************************************************
+
+/**
+ *  @brief The graph node control block runs a single node of a task graph.
+ *         Once done it counts down the unfinished inputs of its successors
+ *         and enqueues those which have none left. Nodes are reset and run
+ *         again for every run of the graph.
+ */
+class GraphNodeControlBlock : public TaskThread
+{
+    friend class TaskGraph;
+
+public:
+
+    //**************************************************************************
+    // MARK: Constructor
+    //**************************************************************************
+
+    /**
+     *  @brief Function constructor.
+     *
+     *  @param pGraph The graph the node belongs to.
+     *  @param id The node identifier within the graph.
+     *  @param function The node function.
+     */
+    GraphNodeControlBlock(TaskGraph* pGraph, size_t id, MoveOnlyFunction<void()> function)
+    : m_pGraph(pGraph),
+      m_id(id),
+      m_function(std::move(function)),
+      m_inputCount(0),
+      m_pendingCount(0)
+    {}
+
+protected:
+
+    //**************************************************************************
+    // MARK: Run Task
+    //**************************************************************************
+
+    /**
+     *  @brief Run the node function, unless the graph faulted, and schedule
+     *         the successors.
+     */
+    void
+    Execute() override;
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    TaskGraph* m_pGraph;
+    size_t m_id;
+    MoveOnlyFunction<void()> m_function;
+    std::vector<GraphNodeControlBlock*> m_successors;
+    size_t m_inputCount;
+    std::atomic<size_t> m_pendingCount;
+};
+
+//******************************************************************************
+// MARK: Graph Completion Control Block
+//******************************************************************************
+
+/**
+ *  @brief The graph completion control block is done once every node of a 
+ *         graph run is done. It is never enqueued.
+ */
+class GraphCompletionControlBlock : public TaskThread
+{
+    friend class TaskGraph;
+
+protected:
+
+    //**************************************************************************
+    // MARK: Run Task
+    //**************************************************************************
+
+    /**
+     *  @brief Nothing to execute, the graph completes the control block.
+     */
+    void
+    Execute() override
+    {}
+
+    /**
+     *  @brief The graph completes the control block, it is never ready.
+     *
+     *  @returns Always false.
+     */
+    bool
+    IsReady() const override
+    {
+        return false;
+    }
+};
+
+//******************************************************************************
+// MARK: Task Graph
+//******************************************************************************
+
+/**
+ *  @brief The task graph runs a set of node functions with dependencies 
+ *         between them. The graph is declared once and run many times, nodes
+ *         run as soon as all of their inputs are done. Running a declared
+ *         graph again does not allocate anything new.
+ *
+ *         Nodes pass data through the state their functions capture. If a
+ *         node function throws, the remaining nodes of that run are skipped
+ *         and the graph faults with the first exception.
+ *
+ *         The graph has to outlive its runs, destroying a graph waits for the
+ *         current run to finish.
+ */
+class TaskGraph
+{
+    friend class GraphNodeControlBlock;
+
+public:
+
+    /**
+     *  @brief The identifier of a graph node.
+     */
+    using NodeId = size_t;
+
+    //**************************************************************************
+    // MARK: Constructor / Destructor
+    //**************************************************************************
+
+    /**
+     *  @brief Default constructor.
+     */
+    TaskGraph();
+
+    /**
+     *  @brief Copy constructor. Disabled for this class.
+     *
+     *  @param c_rTaskGraph TaskGraph class source.
+     */
+    TaskGraph(const TaskGraph& c_rTaskGraph) = delete;
+
+    /**
+     *  @brief Default destructor. Waits for the current run to finish.
+     */
+    ~TaskGraph() noexcept;
+
+    //**************************************************************************
+    // MARK: Declare Graph
+    //**************************************************************************
+
+    /**
+     *  @brief Add a node to the graph. Throws if the graph is running.
+     *
+     *  @param function The node function.
+     *  @param priority The priority to enqueue the node with.
+     *
+     *  @returns The node identifier.
+     */
+    NodeId
+    AddNode(MoveOnlyFunction<void()> function, TaskPriority priority = TaskPriority::NORMAL);
+
+    /**
+     *  @brief Add a dependency between two nodes, the second node runs once
+     *         the first one is done. Throws if a node does not exist, both 
+     *         nodes are the same or the graph is running. Cycles are rejected
+     *         when running the graph.
+     *
+     *  @param from The node to run first.
+     *  @param to The node to run afterwards.
+     */
+    void
+    AddEdge(NodeId from, NodeId to);
+
+    /**
+     *  @brief Get the number of graph nodes.
+     *
+     *  @returns The node count.
+     */
+    size_t
+    GetNodeCount() const noexcept
+    {
+        return m_nodes.size();
+    }
+
+    //**************************************************************************
+    // MARK: Run Graph
+    //**************************************************************************
+
+    /**
+     *  @brief Run the graph and wait for it. Rethrows the exception of a 
+     *         faulted run.
+     */
+    void
+    Run();
+
+    /**
+     *  @brief Run the graph on the pool of the calling thread, or the default
+     *         pool if the calling thread is not a pool thread. Throws if the 
+     *         graph is already running or contains a cycle.
+     */
+    void
+    RunAsync();
+
+    /**
+     *  @brief Run the graph on a pool. Throws if the graph is already running
+     *         or contains a cycle.
+     *
+     *  @param rPool The pool to run the graph on.
+     */
+    void
+    RunAsync(Pool& rPool);
+
+    //**************************************************************************
+    // MARK: Await Graph
+    //**************************************************************************
+
+    /**
+     *  @brief Wait for the current run to finish. Returns immediately if the
+     *         graph is not running. This function is thread-safe.
+     */
+    void
+    Await() const;
+
+    /**
+     *  @brief Wait for the current run to finish, but no longer than a wait 
+     *         time. This function is thread-safe.
+     *
+     *  @param waitTime The maximum time to wait.
+     *
+     *  @returns True if the graph is not running, false on timeout.
+     */
+    bool
+    AwaitFor(std::chrono::nanoseconds waitTime) const;
+
+    /**
+     *  @brief Wait for the current run to finish and rethrow the exception of
+     *         a faulted run. This function is thread-safe.
+     */
+    void
+    AwaitResult() const;
+
+    /**
+     *  @brief Get the state of the latest run. Graphs never run are waiting.
+     *         This function is thread-safe.
+     *
+     *  @returns The graph state.
+     */
+    TaskState
+    GetState() const noexcept
+    {
+        return m_pCompletion->GetState();
+    }
+
+private:
+
+    //**************************************************************************
+    // MARK: Run Graph
+    //**************************************************************************
+
+    /**
+     *  @brief Run the graph on a pool.
+     *
+     *  @param pPool The pool to run on, or nullptr for the pool of the 
+     *               calling thread.
+     */
+    void
+    Start(Pool* pPool);
+
+    /**
+     *  @brief Check the graph for cycles and collect the nodes without 
+     *         inputs.
+     */
+    void
+    Validate();
+
+    /**
+     *  @brief Enqueue a node whose inputs are done. A node which fails to be
+     *         enqueued faults the run and is skipped on the calling thread.
+     *
+     *  @param pNode The node to enqueue.
+     */
+    void
+    Schedule(GraphNodeControlBlock* pNode) noexcept;
+
+    /**
+     *  @brief Record the exception of a node, the first one wins.
+     *
+     *  @param pException The exception.
+     */
+    void
+    Fault(std::exception_ptr pException) noexcept;
+
+    /**
+     *  @brief Check if the current run faulted.
+     *
+     *  @returns True if faulted, false if not.
+     */
+    bool
+    IsFaulted() const noexcept
+    {
+        return m_faulted.load(std::memory_order_acquire);
+    }
+
+    /**
+     *  @brief Count a done node, the last one completes the run.
+     */
+    void
+    CompleteNode() noexcept;
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    std::vector<IntrusivePointer<GraphNodeControlBlock>> m_nodes;
+    std::vector<GraphNodeControlBlock*> m_roots;
+    IntrusivePointer<GraphCompletionControlBlock> m_pCompletion;
+    bool m_validated;
+
+    Pool* m_pPool;
+    std::atomic<size_t> m_remaining;
+    std::atomic<bool> m_faulted;
+    std::mutex m_exceptionMutex;
+    std::exception_ptr m_pException;
+};
+
+// Namespace
+}
+
+#endif /* libcpptask_CppTask_TaskGraph_h */
@@ -0,0 +1,130 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef libcpptask_CppTask_TaskGroup_h
+#define libcpptask_CppTask_TaskGroup_h
+
+// STL
+#include <memory>
+
+// External
+
+// Project
+#include "./CppTask_ITask.h"
+#include "./CppTask_Pool.h"
+#include "./CppTask_MoveOnlyFunction.h"
+
+
+// Namespace
+namespace CppTask {
+
+// Forward declarations
+struct TaskGroupState;
+
+//******************************************************************************
+// MARK: Task Group
+//******************************************************************************
+
+/**
+ *  @brief The task group is a scope for child tasks. Children are spawned 
+ *         into the group and run on the pool, waiting for the group runs the 
+ *         children nobody started yet on the calling thread instead of 
+ *         sleeping. Groups can be nested inside pool tasks to any depth 
+ *         without running out of pool threads: the waiting thread only sleeps
+ *         for children already running elsewhere.
+ *
+ *         If a child throws, children not started yet are skipped and the 
+ *         first exception is rethrown by Wait(). Destroying a group waits for
+ *         its children, children may capture state of the waiting scope by
+ *         reference.
+ */
+class TaskGroup
+{
+public:
+
+    //**************************************************************************
+    // MARK: Constructor / Destructor
+    //**************************************************************************
+
+    /**
+     *  @brief Default constructor. Children run on the pool of the calling 
+     *         thread, or the default pool if the calling thread is not a pool
+     *         thread.
+     */
+    TaskGroup();
+
+    /**
+     *  @brief Pool constructor. The pool has to outlive the group.
+     *
+     *  @param rPool The pool to run the children on.
+     */
+    explicit TaskGroup(Pool& rPool);
+
+    /**
+     *  @brief Copy constructor. Disabled for this class.
+     *
+     *  @param c_rTaskGroup TaskGroup class source.
+     */
+    TaskGroup(const TaskGroup& c_rTaskGroup) = delete;
+
+    /**
+     *  @brief Default destructor. Waits for all children, exceptions are 
+     *         dropped.
+     */
+    ~TaskGroup() noexcept;
+
+    //**************************************************************************
+    // MARK: Spawn
+    //**************************************************************************
+
+    /**
+     *  @brief Spawn a child into the group. Children may spawn further 
+     *         children into the same group. This function is thread-safe.
+     *
+     *  @param function The child function.
+     *  @param priority The priority to run the child with.
+     */
+    void
+    Spawn(MoveOnlyFunction<void()> function, TaskPriority priority = TaskPriority::NORMAL);
+
+    //**************************************************************************
+    // MARK: Wait
+    //**************************************************************************
+
+    /**
+     *  @brief Wait for all children, running those not started yet on the 
+     *         calling thread. Rethrows the first exception thrown by a child.
+     *         The group can be used again afterwards. This function is 
+     *         thread-safe.
+     */
+    void
+    Wait();
+
+private:
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    std::shared_ptr<TaskGroupState> m_pState;
+    Pool* m_pPool;
+};
+
+// Namespace
+}
+
+#endif /* libcpptask_CppTask_TaskGroup_h */
@@ -0,0 +1,237 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef libcpptask_CppTask_TaskResult_h
+#define libcpptask_CppTask_TaskResult_h
+
+// STL
+#include <new>
+#include <optional>
+#include <utility>
+#include <type_traits>
+
+// External
+
+// Project
+
+
+// Namespace
+namespace CppTask {
+
+//******************************************************************************
+// MARK: Task Result Storage
+//******************************************************************************
+
+/**
+ *  @brief The task result stores the typed result of a task. The result is 
+ *         stored inline, no type erasure or heap allocation is involved.
+ *         This storage is not thread-safe, the owner has to synchronise 
+ *         access.
+ */
+template <typename T, bool = std::is_trivially_copyable_v<T>>
+class TaskResult
+{
+public:
+
+    //**************************************************************************
+    // MARK: Result
+    //**************************************************************************
+
+    /**
+     *  @brief Check if a result is stored.
+     *
+     *  @returns True if a result is stored, false if not.
+     */
+    bool
+    HasValue() const noexcept
+    {
+        return m_value.has_value();
+    }
+
+    /**
+     *  @brief Store a result, replacing any result stored before.
+     *
+     *  @param value The result to store.
+     */
+    template <typename U>
+    void
+    Set(U&& value)
+    {
+        m_value.emplace(std::forward<U>(value));
+    }
+
+    /**
+     *  @brief Get the stored result. A result has to be stored.
+     *
+     *  @returns The stored result.
+     */
+    const T&
+    Get() const noexcept
+    {
+        return *m_value;
+    }
+
+    /**
+     *  @brief Move the stored result out of the storage. A result has to be
+     *         stored. The storage is empty afterwards.
+     *
+     *  @returns The stored result.
+     */
+    T
+    Take()
+    {
+        T value(std::move(*m_value));
+        m_value.reset();
+
+        return value;
+    }
+
+    /**
+     *  @brief Destroy the stored result, if any.
+     */
+    void
+    Reset() noexcept
+    {
+        m_value.reset();
+    }
+
+private:
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    std::optional<T> m_value;
+};
+
+/**
+ *  @brief The task result specialisation for trivially-copyable types. The 
+ *         result is kept in a raw inline buffer which is never destroyed and
+ *         copied bytewise.
+ */
+template <typename T>
+class TaskResult<T, true>
+{
+public:
+
+    //**************************************************************************
+    // MARK: Result
+    //**************************************************************************
+
+    /**
+     *  @brief Check if a result is stored.
+     *
+     *  @returns True if a result is stored, false if not.
+     */
+    bool
+    HasValue() const noexcept
+    {
+        return m_hasValue;
+    }
+
+    /**
+     *  @brief Store a result, replacing any result stored before.
+     *
+     *  @param value The result to store.
+     */
+    template <typename U>
+    void
+    Set(U&& value)
+    {
+        ::new (static_cast<void*>(m_buffer)) T(std::forward<U>(value));
+        m_hasValue = true;
+    }
+
+    /**
+     *  @brief Get the stored result. A result has to be stored.
+     *
+     *  @returns The stored result.
+     */
+    const T&
+    Get() const noexcept
+    {
+        return *std::launder(reinterpret_cast<const T*>(m_buffer));
+    }
+
+    /**
+     *  @brief Copy the stored result out of the storage. A result has to be
+     *         stored. The storage is empty afterwards.
+     *
+     *  @returns The stored result.
+     */
+    T
+    Take() noexcept
+    {
+        m_hasValue = false;
+
+        return Get();
+    }
+
+    /**
+     *  @brief Mark the storage empty.
+     */
+    void
+    Reset() noexcept
+    {
+        m_hasValue = false;
+    }
+
+private:
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    alignas(T) unsigned char m_buffer[sizeof(T)];
+    bool m_hasValue = false;
+};
+
+/**
+ *  @brief The task result specialisation for void tasks. Nothing is stored.
+ */
+template <>
+class TaskResult<void, false>
+{
+public:
+
+    //**************************************************************************
+    // MARK: Result
+    //**************************************************************************
+
+    /**
+     *  @brief Check if a result is stored.
+     *
+     *  @returns Always false, void tasks have no result.
+     */
+    bool
+    HasValue() const noexcept
+    {
+        return false;
+    }
+
+    /**
+     *  @brief Nothing to reset for void tasks.
+     */
+    void
+    Reset() noexcept
+    {}
+};
+
+// Namespace
+}
+
+#endif /* libcpptask_CppTask_TaskResult_h */
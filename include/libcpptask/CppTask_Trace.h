@@ -0,0 +1,98 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef libcpptask_CppTask_Trace_h
+#define libcpptask_CppTask_Trace_h
+
+// STL
+#include <ostream>
+
+// External
+
+// Project
+
+
+// Namespace
+namespace CppTask {
+
+/**
+ *  @brief The trace class records scheduler events of every task, when it was
+ *         enqueued, dequeued, started and finished and on which thread, and 
+ *         exports them in the Chrome trace event format. Open the exported 
+ *         file in chrome://tracing or Perfetto.
+ *
+ *         Tracing is compiled out unless the library is built with the 
+ *         libcpptask_TRACING option.
+ */
+class Trace
+{
+public:
+
+    //**************************************************************************
+    // MARK: Recording
+    //**************************************************************************
+
+    /**
+     *  @brief Check if tracing was compiled into the library.
+     *
+     *  @returns True if tracing is available, false if not.
+     */
+    static bool
+    IsAvailable() noexcept;
+
+    /**
+     *  @brief Start a new recording, discarding previously recorded events. 
+     *         This function is thread-safe.
+     */
+    static void
+    Start();
+
+    /**
+     *  @brief Stop recording. Recorded events are kept until the next
+     *         recording is started. This function is thread-safe.
+     */
+    static void
+    Stop() noexcept;
+
+    /**
+     *  @brief Check if events are currently recorded. This function is 
+     *         thread-safe.
+     *
+     *  @returns True if recording, false if not.
+     */
+    static bool
+    IsRecording() noexcept;
+
+    //**************************************************************************
+    // MARK: Export
+    //**************************************************************************
+
+    /**
+     *  @brief Write the recorded events as Chrome trace event JSON. Every 
+     *         thread keeps its latest events only, older ones are overwritten.
+     *         Stop recording first to get a consistent trace.
+     *
+     *  @param rStream The stream to write to.
+     */
+    static void
+    ExportChromeTrace(std::ostream& rStream);
+};
+
+// Namespace
+}
+
+#endif /* libcpptask_CppTask_Trace_h */
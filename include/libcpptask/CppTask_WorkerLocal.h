@@ -0,0 +1,281 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef libcpptask_CppTask_WorkerLocal_h
+#define libcpptask_CppTask_WorkerLocal_h
+
+// STL
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+
+// External
+
+// Project
+
+
+// Namespace
+namespace CppTask {
+
+//******************************************************************************
+// MARK: Worker Slot
+//******************************************************************************
+
+/**
+ *  @brief The worker slot is a small index unique among all running threads, 
+ *         pool workers and others alike. Threads take the lowest free slot on
+ *         first use and give it back once they exit, so slots stay dense and
+ *         can index into per worker tables.
+ */
+class WorkerSlot
+{
+public:
+
+    //**************************************************************************
+    // MARK: Limits
+    //**************************************************************************
+
+    static constexpr size_t s_maxCount = 4096;
+
+    //**************************************************************************
+    // MARK: Getters
+    //**************************************************************************
+
+    /**
+     *  @brief Get the slot of the calling thread. This function is 
+     *         thread-safe.
+     *
+     *  @returns The slot index.
+     */
+    static size_t
+    GetCurrent();
+
+    /**
+     *  @brief Default constructor. Disabled for this class.
+     */
+    WorkerSlot() = delete;
+};
+
+//******************************************************************************
+// MARK: Worker Local
+//******************************************************************************
+
+/**
+ *  @brief The worker local holds an instance per worker, built lazily once a
+ *         worker asks for it and kept until the worker local is destroyed. 
+ *         Tasks use it for scratch buffers and partial results which stay warm
+ *         in the cache of the worker running them instead of being allocated
+ *         per task. Every instance lives on cache lines of its own.
+ *
+ *         Instances belong to worker slots, not to threads: a thread taking 
+ *         over the slot of an exited thread gets the instance left behind.
+ *         Threads outside of pools get an instance as well.
+ */
+template <typename T>
+class WorkerLocal
+{
+public:
+
+    //**************************************************************************
+    // MARK: Constructor / Destructor
+    //**************************************************************************
+
+    /**
+     *  @brief Default constructor. Instances are default constructed.
+     */
+    WorkerLocal() noexcept
+    : m_factory([](){ return T(); }),
+      m_chunks()
+    {}
+
+    /**
+     *  @brief Factory constructor. The factory may be called by multiple 
+     *         workers at once. Instances need not be default constructible.
+     *
+     *  @param factory The function returning a new instance.
+     */
+    explicit WorkerLocal(std::function<T()> factory) noexcept
+    : m_factory(std::move(factory)),
+      m_chunks()
+    {}
+
+    /**
+     *  @brief Copy constructor. Disabled for this class.
+     *
+     *  @param c_rWorkerLocal WorkerLocal class source.
+     */
+    WorkerLocal(const WorkerLocal& c_rWorkerLocal) = delete;
+
+    /**
+     *  @brief Default destructor. Destroys all instances, no worker may use
+     *         them anymore.
+     */
+    ~WorkerLocal() noexcept
+    {
+        for (auto& rpChunk : m_chunks)
+        {
+            auto pChunk = rpChunk.load(std::memory_order_acquire);
+
+            if (!pChunk)
+            {
+                continue;
+            }
+
+            for (auto& rpInstance : *pChunk)
+            {
+                delete rpInstance.load(std::memory_order_acquire);
+            }
+
+            delete pChunk;
+        }
+    }
+
+    //**************************************************************************
+    // MARK: Access
+    //**************************************************************************
+
+    /**
+     *  @brief Get the instance of the calling worker, building it on first 
+     *         use. This function is thread-safe, the instance is only touched
+     *         by the calling worker.
+     *
+     *  @returns The instance.
+     */
+    T&
+    Get()
+    {
+        auto slot = WorkerSlot::GetCurrent();
+        auto& rpInstance = GetChunk(slot / s_chunkSize)[slot % s_chunkSize];
+
+        // Only the owning worker ever builds the instance of its slot
+        auto pInstance = rpInstance.load(std::memory_order_relaxed);
+
+        if (!pInstance)
+        {
+            pInstance = new Instance(m_factory);
+            rpInstance.store(pInstance, std::memory_order_release);
+        }
+
+        return pInstance->m_value;
+    }
+
+    /**
+     *  @brief Call a function with every instance built so far, for example to
+     *         combine partial results. No worker may use its instance 
+     *         meanwhile.
+     *
+     *  @param rFunction The function to call with every instance.
+     */
+    template <typename F>
+    void
+    ForEach(F&& rFunction)
+    {
+        for (auto& rpChunk : m_chunks)
+        {
+            auto pChunk = rpChunk.load(std::memory_order_acquire);
+
+            if (!pChunk)
+            {
+                continue;
+            }
+
+            for (auto& rpInstance : *pChunk)
+            {
+                if (auto pInstance = rpInstance.load(std::memory_order_acquire))
+                {
+                    rFunction(pInstance->m_value);
+                }
+            }
+        }
+    }
+
+private:
+    
+    //**************************************************************************
+    // MARK: Instance
+    //**************************************************************************
+
+    /**
+     *  @brief The instance is padded to whole cache lines, workers writing to
+     *         their instances never share a line.
+     */
+    struct alignas(64) Instance
+    {
+        /**
+         *  @brief Factory constructor.
+         *
+         *  @param c_rFactory The function returning the value.
+         */
+        explicit Instance(const std::function<T()>& c_rFactory)
+        : m_value(c_rFactory())
+        {}
+
+        T m_value;
+    };
+
+    //**************************************************************************
+    // MARK: Chunks
+    //**************************************************************************
+
+    static constexpr size_t s_chunkSize = 64;
+    static constexpr size_t s_chunkCount = WorkerSlot::s_maxCount / s_chunkSize;
+
+    using Chunk = std::array<std::atomic<Instance*>, s_chunkSize>;
+
+    /**
+     *  @brief Get a chunk of instance pointers, allocating it on first use.
+     *
+     *  @param index The chunk index.
+     *
+     *  @returns The chunk.
+     */
+    Chunk&
+    GetChunk(size_t index)
+    {
+        auto& rpChunk = m_chunks[index];
+        auto pChunk = rpChunk.load(std::memory_order_acquire);
+
+        if (pChunk)
+        {
+            return *pChunk;
+        }
+
+        // Workers of the same chunk may race here, the loser drops its chunk
+        auto pNewChunk = new Chunk();
+
+        if (rpChunk.compare_exchange_strong(pChunk, pNewChunk, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            return *pNewChunk;
+        }
+
+        delete pNewChunk;
+        return *pChunk;
+    }
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    std::function<T()> m_factory;
+    std::array<std::atomic<Chunk*>, s_chunkCount> m_chunks;
+};
+
+// Namespace
+}
+
+#endif /* libcpptask_CppTask_WorkerLocal_h */
@@ -0,0 +1,217 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef libcpptask_CppTask_BoundedQueue_h
+#define libcpptask_CppTask_BoundedQueue_h
+
+// STL
+#include <atomic>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// External
+
+// Project
+#include "../include/libcpptask/CppTask_Exception.h"
+
+
+// Namespace
+namespace CppTask {
+
+/**
+ *  @brief The bounded queue is a lock-free multi-producer / multi-consumer 
+ *         ring buffer. Every slot carries a sequence number which tells
+ *         producers and consumers whether the slot is free or filled for
+ *         their current position. No memory is allocated after construction.
+ */
+template <typename T>
+class BoundedQueue
+{
+public:
+
+    //**************************************************************************
+    // MARK: Constructor
+    //**************************************************************************
+
+    /**
+     *  @brief Default constructor.
+     *
+     *  @param capacity The queue capacity. Has to be a power of two.
+     */
+    BoundedQueue(size_t capacity)
+    : m_cells(capacity),
+      m_mask(capacity - 1),
+      m_enqueuePosition(0),
+      m_dequeuePosition(0)
+    {
+        if (capacity < 2 || (capacity & (capacity - 1)) != 0)
+        {
+            throw Exception("Queue capacity has to be a power of two!");
+        }
+
+        for (size_t i = 0; i < capacity; ++i)
+        {
+            m_cells[i].m_sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     *  @brief Copy constructor. Disabled for this class.
+     *
+     *  @param c_rBoundedQueue BoundedQueue class source.
+     */
+    BoundedQueue(const BoundedQueue& c_rBoundedQueue) = delete;
+
+    //**************************************************************************
+    // MARK: Push / Pop
+    //**************************************************************************
+
+    /**
+     *  @brief Try to push a value to the queue. This function is thread-safe.
+     *
+     *  @param rValue The value to push. Moved from on success only.
+     *
+     *  @returns True if the value was pushed, false if the queue is full.
+     */
+    bool
+    TryPush(T& rValue) noexcept
+    {
+        Cell* pCell;
+        size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            pCell = &m_cells[position & m_mask];
+
+            auto sequence = pCell->m_sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+            if (difference == 0)
+            {
+                if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = m_enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        pCell->m_value = std::move(rValue);
+        pCell->m_sequence.store(position + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     *  @brief Try to pop the oldest value from the queue. This function is
+     *         thread-safe.
+     *
+     *  @param rValue The value to move the popped value to.
+     *
+     *  @returns True if a value was popped, false if the queue is empty.
+     */
+    bool
+    TryPop(T& rValue) noexcept
+    {
+        Cell* pCell;
+        size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            pCell = &m_cells[position & m_mask];
+
+            auto sequence = pCell->m_sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+
+            if (difference == 0)
+            {
+                if (m_dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = m_dequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        rValue = std::move(pCell->m_value);
+        pCell->m_value = T();
+        pCell->m_sequence.store(position + m_mask + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    //**************************************************************************
+    // MARK: Capacity
+    //**************************************************************************
+
+    /**
+     *  @brief Get the queue capacity.
+     *
+     *  @returns The queue capacity.
+     */
+    size_t
+    GetCapacity() const noexcept
+    {
+        return m_mask + 1;
+    }
+
+private:
+
+    //**************************************************************************
+    // MARK: Cell
+    //**************************************************************************
+
+    /**
+     *  @brief A single queue slot. Slots are cache line aligned so producers
+     *         and consumers working on neighbouring slots do not interfere.
+     */
+    struct alignas(64) Cell
+    {
+        std::atomic<size_t> m_sequence;
+        T m_value;
+    };
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    std::vector<Cell> m_cells;
+    const size_t m_mask;
+
+    alignas(64) std::atomic<size_t> m_enqueuePosition;
+    alignas(64) std::atomic<size_t> m_dequeuePosition;
+};
+
+// Namespace
+}
+
+#endif /* libcpptask_CppTask_BoundedQueue_h */
@@ -0,0 +1,720 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+// STL
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#if defined(libcpptask_IO)
+    #if !defined(__linux__)
+        #error "I/O is only available on Linux!"
+    #endif
+
+    #include <sys/epoll.h>
+    #include <sys/eventfd.h>
+    #include <sys/timerfd.h>
+    #include <unistd.h>
+#endif
+
+// External
+
+// Project
+#include "../include/libcpptask/CppTask_IO.h"
+#include "../include/libcpptask/CppTask_Exception.h"
+#include "./CppTask_ThreadPool.h"
+#include "./CppTask_Tracer.h"
+
+
+// Namespace
+namespace CppTask {
+
+#ifdef libcpptask_IO
+
+//******************************************************************************
+// MARK: I/O Control Block
+//******************************************************************************
+
+/**
+ *  @brief The I/O control block is finished by the reactor once its operation
+ *         completed.
+ */
+template <typename T>
+class IOControlBlock : public CompletionControlBlock<T>
+{
+public:
+
+    /**
+     *  @brief Default constructor.
+     */
+    IOControlBlock()
+    : CompletionControlBlock<T>()
+    {}
+
+    /**
+     *  @brief Finish the task with a result.
+     *
+     *  @param result The operation result.
+     */
+    template <typename U = T>
+    std::enable_if_t<!std::is_void_v<U>>
+    Finish(U result)
+    {
+        this->SetResult(std::move(result));
+        this->SetFinished();
+    }
+
+    /**
+     *  @brief Finish the task.
+     */
+    template <typename U = T>
+    std::enable_if_t<std::is_void_v<U>>
+    Finish()
+    {
+        this->SetFinished();
+    }
+
+    /**
+     *  @brief Fault the task with a system error.
+     *
+     *  @param error The error number.
+     *  @param c_pWhat The failed operation.
+     */
+    void
+    Fail(int error, const char* c_pWhat)
+    {
+        this->SetFaulted(std::make_exception_ptr(std::system_error(error, std::system_category(), c_pWhat)));
+    }
+};
+
+//******************************************************************************
+// MARK: Operation
+//******************************************************************************
+
+/**
+ *  @brief An operation waiting for its file descriptor to become ready.
+ */
+class Operation
+{
+public:
+
+    /**
+     *  @brief Default destructor.
+     */
+    virtual ~Operation() noexcept = default;
+
+    /**
+     *  @brief Try the operation once the file descriptor is ready. Called by
+     *         the reactor with its mutex held.
+     *
+     *  @returns True if the operation is done, false if it would block.
+     */
+    virtual bool
+    Attempt() noexcept = 0;
+
+    /**
+     *  @brief Fail the operation before it was attempted.
+     *
+     *  @param error The error number.
+     */
+    void
+    SetError(int error) noexcept
+    {
+        m_error = error;
+    }
+
+    /**
+     *  @brief Finish the task of a done operation. Called without any lock 
+     *         held, continuations run from here.
+     */
+    virtual void
+    Complete() noexcept = 0;
+
+protected:
+
+    int m_error = 0;
+};
+
+/**
+ *  @brief A read or a write.
+ */
+class TransferOperation : public Operation
+{
+public:
+
+    /**
+     *  @brief Transfer constructor.
+     *
+     *  @param fileDescriptor The file descriptor to transfer with.
+     *  @param pBuffer The buffer to transfer from or into.
+     *  @param size The buffer size.
+     *  @param write True to write, false to read.
+     */
+    TransferOperation(int fileDescriptor, void* pBuffer, size_t size, bool write)
+    : m_pTaskThread(new IOControlBlock<size_t>()),
+      m_fileDescriptor(fileDescriptor),
+      m_pBuffer(pBuffer),
+      m_size(size),
+      m_write(write),
+      m_result(0)
+    {}
+
+    bool
+    Attempt() noexcept override
+    {
+        while (true)
+        {
+            auto result = m_write ? ::write(m_fileDescriptor, m_pBuffer, m_size) : 
+                                    ::read(m_fileDescriptor, m_pBuffer, m_size);
+
+            if (result >= 0)
+            {
+                m_result = static_cast<size_t>(result);
+                return true;
+            }
+            else if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                return false;
+            }
+            else if (errno != EINTR)
+            {
+                m_error = errno;
+                return true;
+            }
+        }
+    }
+
+    void
+    Complete() noexcept override
+    {
+        if (m_error)
+        {
+            m_pTaskThread->Fail(m_error, m_write ? "write" : "read");
+        }
+        else
+        {
+            m_pTaskThread->Finish(m_result);
+        }
+    }
+
+    IntrusivePointer<IOControlBlock<size_t>> m_pTaskThread;
+
+private:
+
+    int m_fileDescriptor;
+    void* m_pBuffer;
+    size_t m_size;
+    bool m_write;
+    size_t m_result;
+};
+
+/**
+ *  @brief A timer, the timer descriptor is owned by the operation.
+ */
+class TimerOperation : public Operation
+{
+public:
+
+    /**
+     *  @brief Timer constructor.
+     *
+     *  @param timerDescriptor The timer descriptor to own.
+     */
+    explicit TimerOperation(int timerDescriptor)
+    : m_pTaskThread(new IOControlBlock<void>()),
+      m_timerDescriptor(timerDescriptor)
+    {}
+
+    /**
+     *  @brief Default destructor. Closes the timer descriptor.
+     */
+    ~TimerOperation() noexcept override
+    {
+        ::close(m_timerDescriptor);
+    }
+
+    bool
+    Attempt() noexcept override
+    {
+        std::uint64_t expirations = 0;
+
+        if (::read(m_timerDescriptor, &expirations, sizeof(expirations)) < 0)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+            {
+                return false;
+            }
+
+            m_error = errno;
+        }
+
+        return true;
+    }
+
+    void
+    Complete() noexcept override
+    {
+        if (m_error)
+        {
+            m_pTaskThread->Fail(m_error, "timer");
+        }
+        else
+        {
+            m_pTaskThread->Finish();
+        }
+    }
+
+    IntrusivePointer<IOControlBlock<void>> m_pTaskThread;
+
+private:
+
+    int m_timerDescriptor;
+};
+
+//******************************************************************************
+// MARK: Reactor
+//******************************************************************************
+
+/**
+ *  @brief The reactor waits for the file descriptors of pending operations on
+ *         a single thread. File descriptors are registered one-shot for the
+ *         directions they have operations queued for, ready operations are
+ *         attempted and completed on the reactor thread.
+ */
+class Reactor
+{
+public:
+
+    /**
+     *  @brief Get the singleton class instance, started on first use. This 
+     *         function is thread-safe.
+     *
+     *  @returns The singleton class instance.
+     */
+    static Reactor&
+    Singleton()
+    {
+        static Reactor s_instance;
+        return s_instance;
+    }
+
+    /**
+     *  @brief Default constructor. Starts the reactor thread.
+     */
+    Reactor()
+    : m_epollDescriptor(-1),
+      m_wakeupDescriptor(-1),
+      m_stopping(false)
+    {
+        // Completions enqueue continuations, the default pool has to outlive
+        // the reactor
+        ThreadPool::Singleton();
+
+        m_epollDescriptor = ::epoll_create1(EPOLL_CLOEXEC);
+        m_wakeupDescriptor = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+        epoll_event event {};
+        event.events = EPOLLIN;
+        event.data.fd = m_wakeupDescriptor;
+
+        if (m_epollDescriptor < 0 || 
+            m_wakeupDescriptor < 0 || 
+            ::epoll_ctl(m_epollDescriptor, EPOLL_CTL_ADD, m_wakeupDescriptor, &event) != 0)
+        {
+            auto error = errno;
+
+            Close();
+            throw std::system_error(error, std::system_category(), "epoll");
+        }
+
+        m_thread = std::thread(Run, this);
+    }
+
+    /**
+     *  @brief Default destructor. Stops the reactor thread, pending operations
+     *         are cancelled.
+     */
+    ~Reactor() noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lockGuard(m_mutex);
+            m_stopping = true;
+        }
+
+        std::uint64_t value = 1;
+        [[maybe_unused]] auto result = ::write(m_wakeupDescriptor, &value, sizeof(value));
+
+        m_thread.join();
+
+        std::vector<std::unique_ptr<Operation>> cancelled;
+
+        for (auto& rDescriptor : m_descriptors)
+        {
+            for (auto* pOperations : { &rDescriptor.second.m_readers, &rDescriptor.second.m_writers })
+            {
+                for (auto& rpOperation : *pOperations)
+                {
+                    rpOperation->SetError(ECANCELED);
+                    cancelled.emplace_back(std::move(rpOperation));
+                }
+            }
+        }
+
+        m_descriptors.clear();
+
+        for (auto& rpOperation : cancelled)
+        {
+            rpOperation->Complete();
+        }
+
+        Close();
+    }
+
+    /**
+     *  @brief Queue an operation until its file descriptor is ready. Regular
+     *         files can not be waited for, they are always ready and the
+     *         operation is run immediately. Operations which can not be 
+     *         queued are failed. This function is thread-safe.
+     *
+     *  @param fileDescriptor The file descriptor to wait for.
+     *  @param write True to wait for writability, false for readability.
+     *  @param pOperation The operation.
+     */
+    void
+    Submit(int fileDescriptor, bool write, std::unique_ptr<Operation> pOperation)
+    {
+        int error = 0;
+
+        {
+            std::lock_guard<std::mutex> lockGuard(m_mutex);
+
+            auto [iterator, inserted] = m_descriptors.try_emplace(fileDescriptor);
+            auto& rOperations = write ? iterator->second.m_writers : iterator->second.m_readers;
+
+            rOperations.emplace_back(std::move(pOperation));
+
+            if (Arm(fileDescriptor, iterator->second, inserted ? EPOLL_CTL_ADD : EPOLL_CTL_MOD))
+            {
+                return;
+            }
+
+            error = errno;
+            pOperation = std::move(rOperations.back());
+            rOperations.pop_back();
+
+            if (inserted)
+            {
+                m_descriptors.erase(iterator);
+            }
+        }
+
+        if (error == EPERM)
+        {
+            if (!pOperation->Attempt())
+            {
+                pOperation->SetError(EAGAIN);
+            }
+        }
+        else
+        {
+            pOperation->SetError(error);
+        }
+
+        pOperation->Complete();
+    }
+
+private:
+
+    /**
+     *  @brief The operations queued for a file descriptor.
+     */
+    struct Descriptor
+    {
+        std::deque<std::unique_ptr<Operation>> m_readers;
+        std::deque<std::unique_ptr<Operation>> m_writers;
+    };
+
+    /**
+     *  @brief Register a file descriptor for the directions of its queued 
+     *         operations. The reactor mutex has to be held.
+     *
+     *  @param fileDescriptor The file descriptor.
+     *  @param c_rDescriptor The queued operations.
+     *  @param operation The epoll control operation.
+     *
+     *  @returns True on success, false if epoll rejected the file descriptor.
+     */
+    bool
+    Arm(int fileDescriptor, const Descriptor& c_rDescriptor, int operation) noexcept
+    {
+        epoll_event event {};
+        event.events = static_cast<std::uint32_t>(EPOLLONESHOT);
+
+        if (!c_rDescriptor.m_readers.empty())
+        {
+            event.events |= static_cast<std::uint32_t>(EPOLLIN);
+        }
+
+        if (!c_rDescriptor.m_writers.empty())
+        {
+            event.events |= static_cast<std::uint32_t>(EPOLLOUT);
+        }
+
+        event.data.fd = fileDescriptor;
+
+        return ::epoll_ctl(m_epollDescriptor, operation, fileDescriptor, &event) == 0;
+    }
+
+    /**
+     *  @brief Attempt the queued operations of a direction in order, until 
+     *         one would block.
+     *
+     *  @param rOperations The queued operations.
+     *  @param rDone The done operations to complete.
+     */
+    static void
+    Drain(std::deque<std::unique_ptr<Operation>>& rOperations, 
+          std::vector<std::unique_ptr<Operation>>& rDone)
+    {
+        while (!rOperations.empty() && rOperations.front()->Attempt())
+        {
+            rDone.emplace_back(std::move(rOperations.front()));
+            rOperations.pop_front();
+        }
+    }
+
+    /**
+     *  @brief Close the epoll and wakeup descriptors.
+     */
+    void
+    Close() noexcept
+    {
+        if (m_wakeupDescriptor >= 0)
+        {
+            ::close(m_wakeupDescriptor);
+        }
+
+        if (m_epollDescriptor >= 0)
+        {
+            ::close(m_epollDescriptor);
+        }
+    }
+
+    /**
+     *  @brief Wait for ready file descriptors until stopped.
+     *
+     *  @param pInstance The class instance to run.
+     */
+    static void
+    Run(Reactor* pInstance) noexcept
+    {
+        libcpptask_TRACE_THREAD_NAME("I/O Reactor");
+
+        constexpr int c_eventCapacity = 64;
+        epoll_event events[c_eventCapacity];
+
+        while (true)
+        {
+            auto count = ::epoll_wait(pInstance->m_epollDescriptor, events, c_eventCapacity, -1);
+
+            if (count < 0 && errno != EINTR)
+            {
+                return;
+            }
+
+            std::vector<std::unique_ptr<Operation>> done;
+
+            {
+                std::lock_guard<std::mutex> lockGuard(pInstance->m_mutex);
+
+                if (pInstance->m_stopping)
+                {
+                    return;
+                }
+
+                for (int i = 0; i < count; ++i)
+                {
+                    auto fileDescriptor = events[i].data.fd;
+                    auto iterator = pInstance->m_descriptors.find(fileDescriptor);
+
+                    if (iterator == pInstance->m_descriptors.end())
+                    {
+                        continue;
+                    }
+
+                    // Errors and hang ups are reported by the operations 
+                    // themselves once attempted
+                    auto& rDescriptor = iterator->second;
+
+                    if (events[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP))
+                    {
+                        Drain(rDescriptor.m_readers, done);
+                    }
+
+                    if (events[i].events & (EPOLLOUT | EPOLLERR | EPOLLHUP))
+                    {
+                        Drain(rDescriptor.m_writers, done);
+                    }
+
+                    if (rDescriptor.m_readers.empty() && rDescriptor.m_writers.empty())
+                    {
+                        ::epoll_ctl(pInstance->m_epollDescriptor, EPOLL_CTL_DEL, fileDescriptor, nullptr);
+                        pInstance->m_descriptors.erase(iterator);
+                    }
+                    else if (!pInstance->Arm(fileDescriptor, rDescriptor, EPOLL_CTL_MOD))
+                    {
+                        // Closed while waiting, nothing queued can succeed
+                        auto error = errno;
+
+                        for (auto* pOperations : { &rDescriptor.m_readers, &rDescriptor.m_writers })
+                        {
+                            for (auto& rpOperation : *pOperations)
+                            {
+                                rpOperation->SetError(error);
+                                done.emplace_back(std::move(rpOperation));
+                            }
+                        }
+
+                        pInstance->m_descriptors.erase(iterator);
+                    }
+                }
+            }
+
+            // Finishing the tasks enqueues their continuations, without the 
+            // reactor mutex held
+            for (auto& rpOperation : done)
+            {
+                rpOperation->Complete();
+            }
+        }
+    }
+
+    int m_epollDescriptor;
+    int m_wakeupDescriptor;
+    std::thread m_thread;
+
+    std::mutex m_mutex;
+    std::unordered_map<int, Descriptor> m_descriptors;
+    bool m_stopping;
+};
+
+#endif
+
+//******************************************************************************
+// MARK: Availability
+//******************************************************************************
+
+bool
+IO::IsAvailable() noexcept
+{
+#ifdef libcpptask_IO
+    return true;
+#else
+    return false;
+#endif
+}
+
+//******************************************************************************
+// MARK: Operations
+//******************************************************************************
+
+Task<size_t>
+IO::ReadAsync(int fileDescriptor, void* pBuffer, size_t size)
+{
+#ifdef libcpptask_IO
+    if (!pBuffer && size > 0)
+    {
+        throw Exception("Invalid parameters!");
+    }
+
+    auto pOperation = std::make_unique<TransferOperation>(fileDescriptor, pBuffer, size, false);
+    auto task = MakeTask<size_t>(pOperation->m_pTaskThread);
+
+    Reactor::Singleton().Submit(fileDescriptor, false, std::move(pOperation));
+
+    return task;
+#else
+    throw Exception("I/O is not available in this build!");
+#endif
+}
+
+Task<size_t>
+IO::WriteAsync(int fileDescriptor, const void* c_pBuffer, size_t size)
+{
+#ifdef libcpptask_IO
+    if (!c_pBuffer && size > 0)
+    {
+        throw Exception("Invalid parameters!");
+    }
+
+    // The buffer is only ever read from
+    auto pOperation = std::make_unique<TransferOperation>(fileDescriptor, const_cast<void*>(c_pBuffer), size, true);
+    auto task = MakeTask<size_t>(pOperation->m_pTaskThread);
+
+    Reactor::Singleton().Submit(fileDescriptor, true, std::move(pOperation));
+
+    return task;
+#else
+    throw Exception("I/O is not available in this build!");
+#endif
+}
+
+Task<void>
+IO::Timer(std::chrono::nanoseconds duration)
+{
+#ifdef libcpptask_IO
+    // A zero expiration disarms a timer descriptor, expire right away instead
+    duration = std::max(duration, std::chrono::nanoseconds(1));
+
+    auto timerDescriptor = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+
+    if (timerDescriptor < 0)
+    {
+        throw std::system_error(errno, std::system_category(), "timerfd_create");
+    }
+
+    auto pOperation = std::make_unique<TimerOperation>(timerDescriptor);
+    auto task = MakeTask<void>(pOperation->m_pTaskThread);
+
+    auto seconds = std::chrono::duration_cast<std::chrono::seconds>(duration);
+
+    itimerspec expiration {};
+    expiration.it_value.tv_sec = static_cast<time_t>(seconds.count());
+    expiration.it_value.tv_nsec = static_cast<long>((duration - seconds).count());
+
+    if (::timerfd_settime(timerDescriptor, 0, &expiration, nullptr) != 0)
+    {
+        throw std::system_error(errno, std::system_category(), "timerfd_settime");
+    }
+
+    Reactor::Singleton().Submit(timerDescriptor, false, std::move(pOperation));
+
+    return task;
+#else
+    throw Exception("I/O is not available in this build!");
+#endif
+}
+
+// Namespace
+}
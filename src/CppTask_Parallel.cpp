@@ -0,0 +1,184 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// STL
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <vector>
+
+// External
+
+// Project
+#include "../include/libcpptask/CppTask_Parallel.h"
+#include "../include/libcpptask/CppTask_Task.h"
+#include "./CppTask_ThreadPool.h"
+
+
+// Namespace
+namespace CppTask {
+
+//******************************************************************************
+// MARK: Parallel State
+//******************************************************************************
+
+/**
+ *  @brief The parallel state is shared by the calling thread and all pool 
+ *         helpers of a single ParallelChunks() call. Helpers which start after
+ *         all chunks were claimed only touch this state, never the function.
+ */
+struct ParallelState
+{
+    const std::function<void(size_t begin, size_t end)>* m_pFunction;
+
+    size_t m_count;
+    size_t m_grainSize;
+    size_t m_participantCount;
+
+    std::atomic<size_t> m_nextIndex;
+    std::atomic<size_t> m_doneCount;
+
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::exception_ptr m_pException;
+};
+
+//******************************************************************************
+// MARK: Run Chunks
+//******************************************************************************
+
+/**
+ *  @brief Claim and run chunks until none are left.
+ *
+ *  @param rState The parallel state.
+ */
+static void
+RunChunks(ParallelState& rState) noexcept
+{
+    size_t begin = rState.m_nextIndex.load(std::memory_order_relaxed);
+
+    while (begin < rState.m_count)
+    {
+        // Take a share of what is left, large chunks first and smaller ones
+        // towards the end so threads finish at roughly the same time
+        auto chunkSize = (rState.m_count - begin) / (2 * rState.m_participantCount);
+        chunkSize = std::max(chunkSize, rState.m_grainSize);
+
+        auto end = std::min(begin + chunkSize, rState.m_count);
+
+        if (!rState.m_nextIndex.compare_exchange_weak(begin, end, std::memory_order_relaxed))
+        {
+            continue;
+        }
+
+        try
+        {
+            (*rState.m_pFunction)(begin, end);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lockGuard(rState.m_mutex);
+
+            if (!rState.m_pException)
+            {
+                rState.m_pException = std::current_exception();
+            }
+        }
+
+        if (rState.m_doneCount.fetch_add(end - begin, std::memory_order_acq_rel) + (end - begin) == rState.m_count)
+        {
+            std::lock_guard<std::mutex> lockGuard(rState.m_mutex);
+            rState.m_condition.notify_all();
+        }
+
+        begin = rState.m_nextIndex.load(std::memory_order_relaxed);
+    }
+}
+
+//******************************************************************************
+// MARK: Parallel Chunks
+//******************************************************************************
+
+void
+ParallelChunks(size_t count,
+               size_t grainSize,
+               const std::function<void(size_t begin, size_t end)>& c_rFunction)
+{
+    if (!c_rFunction)
+    {
+        throw Exception("Invalid parameters!");
+    }
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    grainSize = std::max<size_t>(grainSize, 1);
+
+    auto helperCount = std::min(ThreadPool::Current().GetThreadCount(), (count - 1) / grainSize);
+
+    if (helperCount == 0)
+    {
+        c_rFunction(0, count);
+        return;
+    }
+
+    auto pState = std::make_shared<ParallelState>();
+    pState->m_pFunction = &c_rFunction;
+    pState->m_count = count;
+    pState->m_grainSize = grainSize;
+    pState->m_participantCount = helperCount + 1;
+    pState->m_nextIndex = 0;
+    pState->m_doneCount = 0;
+
+    std::vector<Task<void>> helpers;
+    helpers.reserve(helperCount);
+
+    for (size_t i = 0; i < helperCount; ++i)
+    {
+        helpers.emplace_back([pState](){
+            RunChunks(*pState);
+        });
+    }
+
+    // Submit all helpers at once, waking the idle workers in one go
+    RunAllAsync(helpers);
+
+    // Help out instead of sleeping, then wait for chunks still running on
+    // pool threads. Helpers not started yet will find nothing left to do
+    RunChunks(*pState);
+
+    {
+        std::unique_lock<std::mutex> uniqueLock(pState->m_mutex);
+
+        pState->m_condition.wait(uniqueLock, [&pState](){
+            return pState->m_doneCount.load(std::memory_order_acquire) == pState->m_count;
+        });
+
+        if (pState->m_pException)
+        {
+            std::rethrow_exception(pState->m_pException);
+        }
+    }
+}
+
+// Namespace
+}
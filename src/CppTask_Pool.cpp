@@ -0,0 +1,105 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// STL
+
+// External
+
+// Project
+#include "../include/libcpptask/CppTask_Pool.h"
+#include "./CppTask_ThreadPool.h"
+
+
+// Namespace
+namespace CppTask {
+
+//******************************************************************************
+// MARK: Constructor / Destructor
+//******************************************************************************
+
+Pool::Pool(const PoolOptions& c_rOptions)
+: m_pOwnedThreadPool(std::make_unique<ThreadPool>(c_rOptions)),
+  m_pThreadPool(m_pOwnedThreadPool.get())
+{}
+
+Pool::Pool(ThreadPool& rThreadPool) noexcept
+: m_pOwnedThreadPool(nullptr),
+  m_pThreadPool(&rThreadPool)
+{}
+
+Pool::~Pool() noexcept = default;
+
+//******************************************************************************
+// MARK: Default Pool
+//******************************************************************************
+
+Pool&
+Pool::Default()
+{
+    static Pool s_pool(ThreadPool::Singleton());
+    return s_pool;
+}
+
+//******************************************************************************
+// MARK: Workers
+//******************************************************************************
+
+size_t
+Pool::GetCurrentWorkerIndex() noexcept
+{
+    return ThreadPool::CurrentWorkerIndex();
+}
+
+//******************************************************************************
+// MARK: Getters
+//******************************************************************************
+
+size_t
+Pool::GetThreadCount() const noexcept
+{
+    return m_pThreadPool->GetThreadCount();
+}
+
+PoolMetrics
+Pool::GetMetrics() const
+{
+    return m_pThreadPool->GetMetrics();
+}
+
+//******************************************************************************
+// MARK: Blocking Region
+//******************************************************************************
+
+BlockingRegion::BlockingRegion() noexcept
+: m_pThreadPool(ThreadPool::CurrentWorkerPool())
+{
+    if (m_pThreadPool)
+    {
+        m_pThreadPool->BeginBlocking();
+    }
+}
+
+BlockingRegion::~BlockingRegion() noexcept
+{
+    if (m_pThreadPool)
+    {
+        m_pThreadPool->EndBlocking();
+    }
+}
+
+// Namespace
+}
@@ -0,0 +1,465 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+// STL
+#include <algorithm>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// External
+
+// Project
+#include "../include/libcpptask/CppTask_Schedule.h"
+#include "../include/libcpptask/CppTask_Task.h"
+#include "../include/libcpptask/CppTask_Pool.h"
+#include "./CppTask_Scheduler.h"
+#include "./CppTask_ThreadPool.h"
+#include "./CppTask_Tracer.h"
+
+
+#ifndef libcpptask_TIMER_RESOLUTION
+    #define libcpptask_TIMER_RESOLUTION 1000 // Microseconds
+#endif
+
+#if libcpptask_TIMER_RESOLUTION < (1)
+    #error "Invalid timer resolution, has to be at least one microsecond!"
+#endif
+
+
+// Namespace
+namespace CppTask {
+
+//******************************************************************************
+// MARK: Scheduled Control Block
+//******************************************************************************
+
+/**
+ *  @brief The scheduled control block runs a scheduled function. Periodic 
+ *         functions reuse their control block for every run.
+ */
+class ScheduledControlBlock : public TaskThread
+{
+public:
+
+    /**
+     *  @brief Function constructor.
+     *
+     *  @param function The function to run.
+     *  @param priority The priority to run the function with.
+     */
+    ScheduledControlBlock(MoveOnlyFunction<void()> function, TaskPriority priority)
+    : TaskThread(),
+      m_function(std::move(function)),
+      m_started(false),
+      m_cancelled(false)
+    {
+        SetPriority(priority);
+    }
+
+    /**
+     *  @brief Enqueue the next run on the default pool, unless the previous
+     *         run is still queued or running. Called by the timer thread only.
+     */
+    void
+    Fire()
+    {
+        if (m_started)
+        {
+            if (!IsDone(GetState()))
+            {
+                return;
+            }
+
+            Reset();
+        }
+
+        // A full pool skips this run, the next fire tries again
+        m_started = false;
+        ThreadPool::Singleton().Enqueue(IntrusivePointer<TaskThread>(this), GetPriority());
+        m_started = true;
+    }
+
+    /**
+     *  @brief Skip every run which did not start yet and wait for a run which
+     *         did, unless called from within that run. This function is 
+     *         thread-safe.
+     */
+    void
+    Cancel() noexcept
+    {
+        std::unique_lock<std::mutex> uniqueLock(m_runMutex);
+
+        m_cancelled = true;
+
+        if (m_runThread == std::thread::id() || m_runThread == std::this_thread::get_id())
+        {
+            return;
+        }
+
+        BlockingRegion blockingRegion;
+
+        m_runCondition.wait(uniqueLock, [this](){
+            return m_runThread == std::thread::id();
+        });
+    }
+
+protected:
+
+    /**
+     *  @brief Run the function and finish the run, or skip it if cancelled.
+     */
+    void
+    Execute() override
+    {
+        {
+            std::lock_guard<std::mutex> lockGuard(m_runMutex);
+
+            if (m_cancelled)
+            {
+                SetCancelled();
+                return;
+            }
+
+            m_runThread = std::this_thread::get_id();
+        }
+
+        try
+        {
+            m_function();
+        }
+        catch (...)
+        {
+            EndRun();
+            throw;
+        }
+
+        EndRun();
+        SetFinished();
+    }
+
+private:
+
+    /**
+     *  @brief Release everybody cancelling while the function ran.
+     */
+    void
+    EndRun() noexcept
+    {
+        std::lock_guard<std::mutex> lockGuard(m_runMutex);
+
+        m_runThread = std::thread::id();
+        m_runCondition.notify_all();
+    }
+
+    MoveOnlyFunction<void()> m_function;
+    bool m_started;
+
+    // Cancelling synchronizes with the run, nothing runs the function once
+    // cancelling returned
+    std::mutex m_runMutex;
+    std::condition_variable m_runCondition;
+    std::thread::id m_runThread;
+    bool m_cancelled;
+};
+
+//******************************************************************************
+// MARK: Scheduler
+//******************************************************************************
+
+Scheduler::Scheduler()
+: m_startTime(Clock::now()),
+  m_resolution(std::chrono::duration_cast<Clock::duration>(std::chrono::microseconds(libcpptask_TIMER_RESOLUTION))),
+  m_wakeTick(0),
+  m_stopping(false)
+{
+    // Fired entries enqueue onto the default pool, it has to outlive us
+    ThreadPool::Singleton();
+
+    m_thread = std::thread(Run, this);
+}
+
+Scheduler::~Scheduler() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(m_mutex);
+
+        m_stopping = true;
+        m_condition.notify_all();
+    }
+
+    m_thread.join();
+
+    // Entries only keep themselves alive while linked
+    std::vector<std::shared_ptr<SchedulerEntry>> entries;
+
+    m_wheel.Clear([&entries](TimerNode* pNode){
+        entries.emplace_back(std::move(static_cast<SchedulerEntry*>(pNode)->m_pSelf));
+    });
+}
+
+Scheduler&
+Scheduler::Singleton()
+{
+    static Scheduler s_instance;
+    return s_instance;
+}
+
+std::shared_ptr<SchedulerEntry>
+Scheduler::Schedule(Clock::time_point deadline, std::chrono::nanoseconds period, MoveOnlyFunction<void()> fire)
+{
+    auto pEntry = std::make_shared<SchedulerEntry>();
+    pEntry->m_deadline = deadline;
+    pEntry->m_period = period;
+    pEntry->m_fire = std::move(fire);
+
+    std::lock_guard<std::mutex> lockGuard(m_mutex);
+
+    Insert(pEntry);
+
+    // Only wake the timer thread if it sleeps past the new entry
+    if (pEntry->m_tick < m_wakeTick)
+    {
+        m_condition.notify_one();
+    }
+
+    return pEntry;
+}
+
+bool
+Scheduler::Cancel(SchedulerEntry& rEntry) noexcept
+{
+    // Released after unlocking, the entry may hold the last reference of 
+    // anything its fire function captured
+    std::shared_ptr<SchedulerEntry> pSelf;
+
+    std::lock_guard<std::mutex> lockGuard(m_mutex);
+
+    auto periodic = rEntry.m_period.count() > 0 && !rEntry.m_cancelled;
+    rEntry.m_cancelled = true;
+
+    if (m_wheel.Remove(&rEntry))
+    {
+        pSelf = std::move(rEntry.m_pSelf);
+        return true;
+    }
+
+    // A periodic entry being fired right now is not linked 
+    return periodic;
+}
+
+bool
+Scheduler::IsPending(const SchedulerEntry& c_rEntry) const noexcept
+{
+    std::lock_guard<std::mutex> lockGuard(m_mutex);
+
+    return c_rEntry.IsLinked() || (c_rEntry.m_period.count() > 0 && !c_rEntry.m_cancelled);
+}
+
+std::uint64_t
+Scheduler::GetTick(Clock::time_point time) const noexcept
+{
+    if (time <= m_startTime)
+    {
+        return 0;
+    }
+
+    // Round up, entries never fire early
+    return static_cast<std::uint64_t>((time - m_startTime + m_resolution - Clock::duration(1)) / m_resolution);
+}
+
+Scheduler::Clock::time_point
+Scheduler::GetTime(std::uint64_t tick) const noexcept
+{
+    return m_startTime + m_resolution * static_cast<Clock::rep>(tick);
+}
+
+void
+Scheduler::Insert(const std::shared_ptr<SchedulerEntry>& c_rpEntry) noexcept
+{
+    m_wheel.Insert(c_rpEntry.get(), GetTick(c_rpEntry->m_deadline));
+    c_rpEntry->m_pSelf = c_rpEntry;
+}
+
+void
+Scheduler::Run(Scheduler* pInstance) noexcept
+{
+    libcpptask_TRACE_THREAD_NAME("Timer");
+
+    std::vector<std::shared_ptr<SchedulerEntry>> expired;
+    std::unique_lock<std::mutex> uniqueLock(pInstance->m_mutex);
+
+    while (!pInstance->m_stopping)
+    {
+        pInstance->m_wakeTick = 0;
+
+        auto now = Clock::now();
+        auto nowTick = static_cast<std::uint64_t>((now - pInstance->m_startTime) / pInstance->m_resolution);
+
+        pInstance->m_wheel.Advance(nowTick, [&expired](TimerNode* pNode){
+            expired.emplace_back(std::move(static_cast<SchedulerEntry*>(pNode)->m_pSelf));
+        });
+
+        if (!expired.empty())
+        {
+            // Fire functions only enqueue, but they take the pool locks
+            uniqueLock.unlock();
+
+            for (auto& rpEntry : expired)
+            {
+                try
+                {
+                    rpEntry->m_fire();
+                }
+                catch (...)
+                {
+                    // A full pool rejected the run, the timer is not retried
+                }
+            }
+
+            uniqueLock.lock();
+
+            for (auto& rpEntry : expired)
+            {
+                if (rpEntry->m_period.count() > 0 && !rpEntry->m_cancelled)
+                {
+                    // Periods missed while falling behind are skipped
+                    rpEntry->m_deadline += rpEntry->m_period;
+                    rpEntry->m_deadline = std::max(rpEntry->m_deadline, now + rpEntry->m_period);
+
+                    pInstance->Insert(rpEntry);
+                }
+            }
+
+            // Dropped entries may release captures, never under our lock
+            uniqueLock.unlock();
+            expired.clear();
+            uniqueLock.lock();
+
+            continue;
+        }
+
+        std::uint64_t nextTick = 0;
+
+        if (pInstance->m_wheel.GetNextTick(nextTick))
+        {
+            pInstance->m_wakeTick = nextTick;
+            pInstance->m_condition.wait_until(uniqueLock, pInstance->GetTime(nextTick));
+        }
+        else
+        {
+            pInstance->m_wakeTick = std::numeric_limits<std::uint64_t>::max();
+            pInstance->m_condition.wait(uniqueLock);
+        }
+    }
+}
+
+//******************************************************************************
+// MARK: Timer Handle
+//******************************************************************************
+
+bool
+TimerHandle::Cancel() noexcept
+{
+    if (!m_pEntry)
+    {
+        return false;
+    }
+
+    auto cancelled = Scheduler::Singleton().Cancel(*m_pEntry);
+
+    // A run handed to the pool already is skipped or waited for
+    if (m_pEntry->m_cancel)
+    {
+        m_pEntry->m_cancel();
+    }
+
+    return cancelled;
+}
+
+bool
+TimerHandle::IsPending() const noexcept
+{
+    return m_pEntry && Scheduler::Singleton().IsPending(*m_pEntry);
+}
+
+//******************************************************************************
+// MARK: Schedule
+//******************************************************************************
+
+/**
+ *  @brief Schedule a function.
+ *
+ *  @param deadline The point in time to run the function at first.
+ *  @param period The time between runs, zero to run once.
+ *  @param function The function to run.
+ *  @param priority The priority to run the function with.
+ *
+ *  @returns The handle to cancel the timer with.
+ */
+static TimerHandle
+Schedule(std::chrono::steady_clock::time_point deadline, 
+         std::chrono::nanoseconds period, 
+         MoveOnlyFunction<void()> function, 
+         TaskPriority priority)
+{
+    if (!function)
+    {
+        throw Exception("Invalid parameters!");
+    }
+
+    IntrusivePointer<ScheduledControlBlock> pTaskThread(new ScheduledControlBlock(std::move(function), priority));
+
+    auto pEntry = Scheduler::Singleton().Schedule(deadline, period, [pTaskThread](){
+        pTaskThread->Fire();
+    });
+
+    // Published to the cancelling thread with the handle, the timer thread
+    // never reads it
+    pEntry->m_cancel = [pTaskThread](){
+        pTaskThread->Cancel();
+    };
+
+    return TimerHandle(std::move(pEntry));
+}
+
+TimerHandle
+RunAfter(std::chrono::nanoseconds delay, MoveOnlyFunction<void()> function, TaskPriority priority)
+{
+    return Schedule(std::chrono::steady_clock::now() + delay, std::chrono::nanoseconds::zero(), std::move(function), priority);
+}
+
+TimerHandle
+RunAt(std::chrono::steady_clock::time_point deadline, MoveOnlyFunction<void()> function, TaskPriority priority)
+{
+    return Schedule(deadline, std::chrono::nanoseconds::zero(), std::move(function), priority);
+}
+
+TimerHandle
+RunEvery(std::chrono::nanoseconds period, MoveOnlyFunction<void()> function, TaskPriority priority)
+{
+    if (period <= std::chrono::nanoseconds::zero())
+    {
+        throw Exception("Invalid parameters!");
+    }
+
+    return Schedule(std::chrono::steady_clock::now() + period, period, std::move(function), priority);
+}
+
+// Namespace
+}
@@ -0,0 +1,211 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef libcpptask_CppTask_Scheduler_h
+#define libcpptask_CppTask_Scheduler_h
+
+// STL
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// External
+
+// Project
+#include "../include/libcpptask/CppTask_MoveOnlyFunction.h"
+#include "./CppTask_TimerWheel.h"
+
+
+// Namespace
+namespace CppTask {
+
+//******************************************************************************
+// MARK: Scheduler Entry
+//******************************************************************************
+
+/**
+ *  @brief The scheduler entry is a single pending timer. A linked entry keeps
+ *         itself alive, handles share it to cancel the timer. The optional
+ *         cancel function is called by the handle after cancelling.
+ */
+struct SchedulerEntry : public TimerNode
+{
+    std::chrono::steady_clock::time_point m_deadline;
+    std::chrono::nanoseconds m_period;
+    MoveOnlyFunction<void()> m_fire;
+    MoveOnlyFunction<void()> m_cancel;
+    std::shared_ptr<SchedulerEntry> m_pSelf;
+    bool m_cancelled = false;
+};
+
+//******************************************************************************
+// MARK: Scheduler
+//******************************************************************************
+
+/**
+ *  @brief The scheduler services a timer wheel on a single timer thread. The
+ *         thread sleeps until the next tick something is due at and calls 
+ *         the fire function of every expired entry, which enqueues the work
+ *         onto a thread pool. Fire functions run on the timer thread and must
+ *         never block.
+ */
+class Scheduler
+{
+public:
+
+    using Clock = std::chrono::steady_clock;
+
+    //**************************************************************************
+    // MARK: Constructor
+    //**************************************************************************
+
+    /**
+     *  @brief Default constructor. Starts the timer thread.
+     */
+    Scheduler();
+
+    /**
+     *  @brief Copy constructor. Disabled for this class.
+     *
+     *  @param c_rScheduler Scheduler class source.
+     */
+    Scheduler(const Scheduler& c_rScheduler) = delete;
+
+    /**
+     *  @brief Default destructor. Stops the timer thread, pending entries 
+     *         never fire.
+     */
+    ~Scheduler() noexcept;
+
+    //**************************************************************************
+    // MARK: Singleton
+    //**************************************************************************
+
+    /**
+     *  @brief Get the singleton class instance, started on first use. This 
+     *         function is thread-safe.
+     *
+     *  @returns The singleton class instance.
+     */
+    static Scheduler&
+    Singleton();
+
+    //**************************************************************************
+    // MARK: Schedule
+    //**************************************************************************
+
+    /**
+     *  @brief Schedule a fire function. This function is thread-safe.
+     *
+     *  @param deadline The point in time to fire at first.
+     *  @param period The time between fires, zero to fire once.
+     *  @param fire The fire function.
+     *
+     *  @returns The entry.
+     */
+    std::shared_ptr<SchedulerEntry>
+    Schedule(Clock::time_point deadline, std::chrono::nanoseconds period, MoveOnlyFunction<void()> fire);
+
+    /**
+     *  @brief Cancel an entry in constant time. This function is thread-safe.
+     *
+     *  @param rEntry The entry to cancel.
+     *
+     *  @returns True if a future fire was prevented, false if not.
+     */
+    bool
+    Cancel(SchedulerEntry& rEntry) noexcept;
+
+    /**
+     *  @brief Check if an entry fires again. This function is thread-safe.
+     *
+     *  @param c_rEntry The entry to check.
+     *
+     *  @returns True if pending, false if not.
+     */
+    bool
+    IsPending(const SchedulerEntry& c_rEntry) const noexcept;
+
+private:
+
+    //**************************************************************************
+    // MARK: Ticks
+    //**************************************************************************
+
+    /**
+     *  @brief Get the first tick at or after a point in time.
+     *
+     *  @param time The point in time.
+     *
+     *  @returns The tick.
+     */
+    std::uint64_t
+    GetTick(Clock::time_point time) const noexcept;
+
+    /**
+     *  @brief Get the point in time a tick starts at.
+     *
+     *  @param tick The tick.
+     *
+     *  @returns The point in time.
+     */
+    Clock::time_point
+    GetTime(std::uint64_t tick) const noexcept;
+
+    /**
+     *  @brief Link an entry into the wheel. The scheduler mutex has to be 
+     *         held.
+     *
+     *  @param c_rpEntry The entry to link.
+     */
+    void
+    Insert(const std::shared_ptr<SchedulerEntry>& c_rpEntry) noexcept;
+
+    //**************************************************************************
+    // MARK: Run Thread
+    //**************************************************************************
+
+    /**
+     *  @brief Advance the wheel and fire expired entries until stopped.
+     *
+     *  @param pInstance The class instance to run.
+     */
+    static void
+    Run(Scheduler* pInstance) noexcept;
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    Clock::time_point m_startTime;
+    Clock::duration m_resolution;
+
+    TimerWheel m_wheel;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::thread m_thread;
+    std::uint64_t m_wakeTick;
+    bool m_stopping;
+};
+
+// Namespace
+}
+
+#endif /* libcpptask_CppTask_Scheduler_h */
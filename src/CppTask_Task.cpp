@@ -16,82 +16,356 @@
  */
 
 // STL
-#include <mutex>
-#include <condition_variable>
+#include <unordered_set>
 
 // External
 
 // Project
 #include "../include/libcpptask/CppTask_Task.h"
+#include "../include/libcpptask/CppTask_Pool.h"
 #include "./CppTask_ThreadPool.h"
+#include "./CppTask_Scheduler.h"
+#include "./CppTask_Tracer.h"
 
 
 // Namespace
 namespace CppTask {
 
 //******************************************************************************
-// MARK: Task Implementation Storage Object
+// MARK: Current Run
 //******************************************************************************
 
-struct TaskThread::Storage
-{
-    mutable std::mutex m_mutex;
-    mutable std::condition_variable m_condition;
-
-    std::function<void(TaskThread& rTaskThread)> m_function;
-    TaskState m_state;
-    std::any m_result;
-};
+thread_local const TaskThread* TaskThread::s_pRunTaskThread = nullptr;
+thread_local TaskState TaskThread::s_runState = TaskState::WAITING;
 
 //******************************************************************************
 // MARK: Constructor
 //******************************************************************************
 
-TaskThread::TaskThread(const std::function<void(TaskThread& rTaskThread)>& c_rFunction)
-: m_pStorage(std::make_shared<Storage>())
-{
-    m_pStorage->m_function = c_rFunction;
-    m_pStorage->m_state = TaskState::WAITING;
-}
+TaskThread::TaskThread() noexcept
+: m_cancellationToken(CancellationToken::None()),
+  m_pName(nullptr),
+  m_referenceCount(0),
+  m_hasListeners(false),
+  m_generation(0),
+  m_claimed(false),
+  m_priority(TaskPriority::NORMAL),
+  m_state(TaskState::WAITING)
+{}
 
 //******************************************************************************
 // MARK: Run Task
 //******************************************************************************
 
 void
-TaskThread::Enqueue(std::shared_ptr<TaskThread> pTaskThread)
+TaskThread::Enqueue(IntrusivePointer<TaskThread> pTaskThread)
+{
+    Enqueue(std::move(pTaskThread), ThreadPool::Current());
+}
+
+void
+TaskThread::Enqueue(IntrusivePointer<TaskThread> pTaskThread, Pool& rPool)
 {
-    std::lock_guard<std::mutex> lockGuard(pTaskThread->m_pStorage->m_mutex);
+    Enqueue(std::move(pTaskThread), *rPool.m_pThreadPool);
+}
 
-    if (pTaskThread->m_pStorage->m_state != TaskState::WAITING)
+void
+TaskThread::Enqueue(IntrusivePointer<TaskThread> pTaskThread, ThreadPool& rThreadPool)
+{
+    if (!pTaskThread)
     {
-        throw Exception("Attempted to enqueue a task already run before!");
+        throw Exception("Invalid parameters!");
     }
 
-    ThreadPool::Singleton().Enqueue(pTaskThread);
+    pTaskThread->Claim();
+
+    try
+    {
+        rThreadPool.Enqueue(pTaskThread, pTaskThread->GetPriority());
+    }
+    catch (...)
+    {
+        pTaskThread->Unclaim();
+        throw;
+    }
+}
+
+void
+TaskThread::EnqueueOrRun(IntrusivePointer<TaskThread> pTaskThread)
+{
+    EnqueueOrRun(std::move(pTaskThread), ThreadPool::Current());
 }
 
 void
+TaskThread::EnqueueOrRun(IntrusivePointer<TaskThread> pTaskThread, Pool& rPool)
+{
+    EnqueueOrRun(std::move(pTaskThread), *rPool.m_pThreadPool);
+}
+
+void
+TaskThread::EnqueueOrRun(IntrusivePointer<TaskThread> pTaskThread, ThreadPool& rThreadPool)
+{
+    if (!pTaskThread)
+    {
+        throw Exception("Invalid parameters!");
+    }
+    else if (!rThreadPool.IsSaturated())
+    {
+        Enqueue(std::move(pTaskThread), rThreadPool);
+        return;
+    }
+
+    // The pool has more than enough queued work, running the task right 
+    // here is cheaper than adding to the queue
+    pTaskThread->Claim();
+    pTaskThread->Run();
+}
+
+void
+TaskThread::EnqueueAll(std::vector<IntrusivePointer<TaskThread>> taskThreads)
+{
+    EnqueueAll(std::move(taskThreads), ThreadPool::Current());
+}
+
+void
+TaskThread::EnqueueAll(std::vector<IntrusivePointer<TaskThread>> taskThreads, Pool& rPool)
+{
+    EnqueueAll(std::move(taskThreads), *rPool.m_pThreadPool);
+}
+
+void
+TaskThread::EnqueueAll(std::vector<IntrusivePointer<TaskThread>> taskThreads, ThreadPool& rThreadPool)
+{
+    std::vector<TaskPriority> priorities;
+    priorities.reserve(taskThreads.size());
+
+    // Claim everything first, we do not want to enqueue half a batch
+    try
+    {
+        for (const auto& c_rpTaskThread : taskThreads)
+        {
+            if (!c_rpTaskThread)
+            {
+                throw Exception("Invalid parameters!");
+            }
+
+            c_rpTaskThread->Claim();
+            priorities.emplace_back(c_rpTaskThread->GetPriority());
+        }
+
+        rThreadPool.EnqueueAll(taskThreads, priorities);
+    }
+    catch (...)
+    {
+        // Only the claimed prefix is given up, the batch got nowhere
+        for (size_t i = 0; i < priorities.size(); ++i)
+        {
+            taskThreads[i]->Unclaim();
+        }
+
+        throw;
+    }
+}
+
+void
+TaskThread::EnqueueAt(IntrusivePointer<TaskThread> pTaskThread, std::chrono::steady_clock::time_point deadline)
+{
+    EnqueueAt(std::move(pTaskThread), deadline, ThreadPool::Current());
+}
+
+void
+TaskThread::EnqueueAt(IntrusivePointer<TaskThread> pTaskThread, std::chrono::steady_clock::time_point deadline, Pool& rPool)
+{
+    EnqueueAt(std::move(pTaskThread), deadline, *rPool.m_pThreadPool);
+}
+
+void
+TaskThread::EnqueueAt(IntrusivePointer<TaskThread> pTaskThread, 
+                      std::chrono::steady_clock::time_point deadline, 
+                      ThreadPool& rThreadPool)
+{
+    if (!pTaskThread)
+    {
+        throw Exception("Invalid parameters!");
+    }
+
+    // The timer holds the claim until it enqueues the task thread
+    pTaskThread->Claim();
+
+    auto pTimerTarget = rThreadPool.GetTimerTarget();
+
+    try
+    {
+        Scheduler::Singleton().Schedule(deadline, std::chrono::nanoseconds::zero(), [pTaskThread, pTimerTarget](){
+            std::exception_ptr pException;
+
+            {
+                std::lock_guard<std::mutex> lockGuard(pTimerTarget->m_mutex);
+
+                // Cancelled tasks are enqueued as well, running skips them. 
+                // Never run inline here, that would hold up the timer thread
+                if (pTimerTarget->m_pThreadPool)
+                {
+                    try
+                    {
+                        pTimerTarget->m_pThreadPool->Enqueue(pTaskThread, pTaskThread->GetPriority());
+                        return;
+                    }
+                    catch (...)
+                    {
+                        pException = std::current_exception();
+                    }
+                }
+            }
+
+            // Nobody is left to run the task thread, waiters are released 
+            // outside of the lock. The claim stays until reset, a done task
+            // thread is never claimed again
+            if (pException)
+            {
+                pTaskThread->SetFaulted(std::move(pException));
+            }
+            else
+            {
+                pTaskThread->SetCancelled();
+            }
+        });
+    }
+    catch (...)
+    {
+        pTaskThread->Unclaim();
+        throw;
+    }
+}
+
+TaskState
 TaskThread::Run()
 {
+    auto state = TaskState::WAITING;
+
+    // Cancelled tasks are skipped, the function never runs
+    if (m_cancellationToken.IsCancelled())
     {
-        std::lock_guard<std::mutex> lockGuard(m_pStorage->m_mutex);
+        auto generation = m_generation.load(std::memory_order_relaxed);
 
-        if (m_pStorage->m_state != TaskState::WAITING)
+        if (!m_state.compare_exchange_strong(state, TaskState::CANCELLED, std::memory_order_acq_rel))
         {
             throw Exception("Attempted to run a task already run before!");
         }
 
-        m_pStorage->m_state = TaskState::RUNNING;
+        NotifyDone(generation);
+        return TaskState::CANCELLED;
     }
 
-    // We do not need a try-catch block here, since this is an external lambda
-    // We will not be able to catch something, the thread will die silently
-    // before or call std::terminate
-    m_pStorage->m_function(*this);
-    
-    // Do not set the state yet, we want to set the result first before that
-    // We have the SetFinished() function to call after the result has been set
+    if (!m_state.compare_exchange_strong(state, TaskState::RUNNING, std::memory_order_acq_rel))
+    {
+        throw Exception("Attempted to run a task already run before!");
+    }
+
+    // The control block calls SetFinished() after the result has been set,
+    // a throwing function faults the task instead so no waiter is left hanging
+    libcpptask_TRACE(TraceEventType::START, this);
+
+    // Functions may run other task threads inline, those record their own 
+    // done state in between
+    auto pPreviousTaskThread = s_pRunTaskThread;
+    auto previousState = s_runState;
+
+    s_pRunTaskThread = this;
+    s_runState = TaskState::RUNNING;
+
+    try
+    {
+        Execute();
+    }
+    catch (...)
+    {
+        SetFaulted(std::current_exception());
+    }
+
+    // Read back instead of the state, which may have been reset and run again
+    // by another thread by now
+    state = s_runState;
+
+    s_pRunTaskThread = pPreviousTaskThread;
+    s_runState = previousState;
+
+    libcpptask_TRACE(TraceEventType::FINISH, this);
+
+    return state;
+}
+
+void
+TaskThread::RunInline()
+{
+    Claim();
+    Run();
+}
+
+void
+TaskThread::Claim()
+{
+    if (GetState() != TaskState::WAITING)
+    {
+        throw Exception("Attempted to enqueue a task already run before!");
+    }
+    else if (!IsReady())
+    {
+        throw Exception("Attempted to enqueue a continuation before its parent finished!");
+    }
+
+    // Waiting but claimed means queued or about to run elsewhere
+    bool claimed = false;
+
+    if (!m_claimed.compare_exchange_strong(claimed, true, std::memory_order_acq_rel))
+    {
+        throw Exception("Attempted to enqueue a task already run before!");
+    }
+}
+
+void
+TaskThread::Reset()
+{
+    std::vector<std::function<void()>> continuations;
+
+    {
+        std::lock_guard<std::mutex> lockGuard(m_mutex);
+
+        auto state = GetState();
+
+        // Waiting but claimed task threads are queued, as good as running
+        if (!CanReset())
+        {
+            throw Exception("Attempted to reset a task which can not run again!");
+        }
+        else if (state == TaskState::RUNNING || (state == TaskState::WAITING && m_claimed.load(std::memory_order_acquire)))
+        {
+            throw Exception("Attempted to reset a running task!");
+        }
+
+        // The finishing thread might not have notified the previous run yet.
+        // Waiters wake on the new generation, the finishing thread sees it 
+        // and leaves the previous run to us
+        if (m_pCondition)
+        {
+            m_pCondition->notify_all();
+        }
+
+        continuations.swap(m_continuations);
+        m_generation.fetch_add(1, std::memory_order_relaxed);
+
+        m_pException = nullptr;
+        ClearResult();
+
+        m_hasListeners.store(false, std::memory_order_relaxed);
+        m_claimed.store(false, std::memory_order_relaxed);
+        m_state.store(TaskState::WAITING, std::memory_order_release);
+    }
+
+    for (auto& rContinuation : continuations)
+    {
+        rContinuation();
+    }
 }
 
 //******************************************************************************
@@ -101,61 +375,246 @@ TaskThread::Run()
 void
 TaskThread::SetFinished()
 {
-    std::lock_guard<std::mutex> lockGuard(m_pStorage->m_mutex);
-    
-    if (m_pStorage->m_state != TaskState::FINISHED)
+    SetDone(TaskState::FINISHED);
+}
+
+void
+TaskThread::SetCancelled()
+{
+    SetDone(TaskState::CANCELLED);
+}
+
+void
+TaskThread::SetFaulted(std::exception_ptr pException)
+{
+    SetDone(TaskState::FAULTED, std::move(pException));
+}
+
+void
+TaskThread::SetDone(TaskState state, std::exception_ptr pException)
+{
+    // A task thread which is not done can not be reset, the generation 
+    // stays until the state moved
+    auto generation = m_generation.load(std::memory_order_relaxed);
+
+    if (pException)
+    {
+        // Faulting is rare, the exception is only published with the state.
+        // A published exception is never touched again, readers do not lock
+        std::lock_guard<std::mutex> lockGuard(m_mutex);
+
+        if (IsDone(GetState()))
+        {
+            return;
+        }
+
+        // Lost to a finishing thread which did not lock, the stored exception
+        // stays unpublished and unread
+        m_pException = std::move(pException);
+
+        if (!TrySetDone(state))
+        {
+            return;
+        }
+    }
+    else if (!TrySetDone(state))
+    {
+        return;
+    }
+
+    NotifyDone(generation);
+}
+
+bool
+TaskThread::TrySetDone(TaskState state) noexcept
+{
+    auto current = m_state.load(std::memory_order_relaxed);
+
+    do
+    {
+        if (IsDone(current))
+        {
+            return false;
+        }
+    }
+    while (!m_state.compare_exchange_weak(current, state, std::memory_order_seq_cst, std::memory_order_relaxed));
+
+    if (s_pRunTaskThread == this)
+    {
+        s_runState = state;
+    }
+
+    return true;
+}
+
+void
+TaskThread::NotifyDone(size_t generation)
+{
+    // Listeners flag themselves before checking the state, while the state 
+    // was moved before checking the flag. One of both sees the other
+    if (!m_hasListeners.load(std::memory_order_seq_cst))
+    {
+        return;
+    }
+
+    std::vector<std::function<void()>> continuations;
+
     {
-        m_pStorage->m_state = TaskState::FINISHED;
-        m_pStorage->m_condition.notify_all();
+        std::lock_guard<std::mutex> lockGuard(m_mutex);
+
+        // Reset in the meantime, the reset notified the run in our place
+        if (m_generation.load(std::memory_order_relaxed) != generation)
+        {
+            return;
+        }
+
+        if (m_pCondition)
+        {
+            m_pCondition->notify_all();
+        }
+
+        continuations.swap(m_continuations);
+    }
+
+    // Continuations are called outside of the lock, they are free to access
+    // this task thread again
+    for (auto& rContinuation : continuations)
+    {
+        rContinuation();
     }
 }
 
 void
 TaskThread::Await() const
 {
-    std::unique_lock<std::mutex> uniqueLock(m_pStorage->m_mutex);
+    if (IsDone(GetState()))
+    {
+        return;
+    }
 
-    if (m_pStorage->m_state != TaskState::FINISHED)
+    // Waiting from a pool thread takes that thread away from the pool
+    BlockingRegion blockingRegion;
+
+    std::unique_lock<std::mutex> uniqueLock(m_mutex);
+
+    m_hasListeners.store(true, std::memory_order_seq_cst);
+
+    if (!m_pCondition)
     {
-        m_pStorage->m_condition.wait(uniqueLock);
+        m_pCondition = std::make_unique<std::condition_variable>();
     }
+
+    // The predicate protects against spurious wakeups. A reset may beat us
+    // to the lock after the run was done, the run we waited for is over 
+    // once the generation moved on
+    auto generation = m_generation.load(std::memory_order_relaxed);
+
+    m_pCondition->wait(uniqueLock, [this, generation](){
+        return IsDone(m_state.load(std::memory_order_seq_cst)) || 
+               m_generation.load(std::memory_order_relaxed) != generation;
+    });
 }
 
-//******************************************************************************
-// MARK: Task Result
-//******************************************************************************
+bool
+TaskThread::AwaitUntil(std::chrono::steady_clock::time_point deadline) const
+{
+    if (IsDone(GetState()))
+    {
+        return true;
+    }
+
+    BlockingRegion blockingRegion;
+
+    std::unique_lock<std::mutex> uniqueLock(m_mutex);
+
+    m_hasListeners.store(true, std::memory_order_seq_cst);
+
+    if (!m_pCondition)
+    {
+        m_pCondition = std::make_unique<std::condition_variable>();
+    }
+
+    auto generation = m_generation.load(std::memory_order_relaxed);
+
+    return m_pCondition->wait_until(uniqueLock, deadline, [this, generation](){
+        return IsDone(m_state.load(std::memory_order_seq_cst)) || 
+               m_generation.load(std::memory_order_relaxed) != generation;
+    });
+}
 
 void
-TaskThread::SetResult(std::any result)
+TaskThread::AddContinuation(std::function<void()> continuation)
 {
-    std::lock_guard<std::mutex> lockGuard(m_pStorage->m_mutex);
+    {
+        std::lock_guard<std::mutex> lockGuard(m_mutex);
+
+        m_hasListeners.store(true, std::memory_order_seq_cst);
 
-    m_pStorage->m_result = std::move(result);
+        if (!IsDone(m_state.load(std::memory_order_seq_cst)))
+        {
+            m_continuations.emplace_back(std::move(continuation));
+            return;
+        }
+    }
+
+    continuation();
 }
 
-const std::any&
-TaskThread::GetResult() const
+//******************************************************************************
+// MARK: Task Exception
+//******************************************************************************
+
+std::exception_ptr
+TaskThread::GetException() const
 {
-    std::lock_guard<std::mutex> lockGuard(m_pStorage->m_mutex);
+    // The exception is published by the faulted state and never changes 
+    // until reset
+    return GetState() == TaskState::FAULTED ? m_pException : nullptr;
+}
 
-    if (!m_pStorage->m_result.has_value())
+void
+TaskThread::RethrowIfFaulted() const
+{
+    if (GetState() == TaskState::FAULTED)
     {
-        throw Exception("No result available to return!");
+        std::rethrow_exception(m_pException);
     }
+}
+
+//******************************************************************************
+// MARK: Cancellation
+//******************************************************************************
 
-    return m_pStorage->m_result;
+void
+TaskThread::SetCancellationToken(CancellationToken token)
+{
+    m_cancellationToken = std::move(token);
 }
 
 //******************************************************************************
-// MARK: Task State
+// MARK: Task Name
 //******************************************************************************
 
-TaskState
-TaskThread::GetState() const
+void
+TaskThread::SetName(const std::string& c_rName)
 {
-    std::lock_guard<std::mutex> lockGuard(m_pStorage->m_mutex);
+    static std::mutex s_nameMutex;
+    static std::unordered_set<std::string> s_names;
+
+    // Set elements never move, traces keep referring to the interned name
+    std::lock_guard<std::mutex> lockGuard(s_nameMutex);
     
-    return m_pStorage->m_state;
+    m_pName.store(&*s_names.insert(c_rName).first, std::memory_order_relaxed);
+}
+
+const std::string&
+TaskThread::GetName() const noexcept
+{
+    static const std::string s_empty;
+
+    auto c_pName = m_pName.load(std::memory_order_relaxed);
+
+    return c_pName ? *c_pName : s_empty;
 }
 
 // Namespace
@@ -0,0 +1,255 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// STL
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+// External
+
+// Project
+#include "../include/libcpptask/CppTask_TaskAllocator.h"
+
+
+#ifndef libcpptask_TASK_ALLOCATOR_CACHE_SIZE
+    #define libcpptask_TASK_ALLOCATOR_CACHE_SIZE 256
+#endif
+
+#if libcpptask_TASK_ALLOCATOR_CACHE_SIZE < (1)
+    #error "Invalid task allocator cache size, has to be at least one!"
+#endif
+
+
+// Namespace
+namespace CppTask {
+
+//******************************************************************************
+// MARK: Thread Cache
+//******************************************************************************
+
+/**
+ *  @brief The thread cache resource keeps a free list per block size class 
+ *         and thread. Blocks freed on another thread than they were allocated
+ *         on join the cache of the freeing thread. Full caches, large blocks
+ *         and over-aligned blocks go to the upstream resource.
+ */
+class ThreadCacheResource : public std::pmr::memory_resource
+{
+public:
+
+    static constexpr std::size_t s_classSize = 64;
+    static constexpr std::size_t s_classCount = 8;
+
+private:
+
+    /**
+     *  @brief A free block, linked into the free list of its size class.
+     */
+    struct FreeBlock
+    {
+        FreeBlock* m_pNext;
+    };
+
+    /**
+     *  @brief The free lists of a thread. Cached blocks are returned upstream
+     *         once the thread exits.
+     */
+    struct Cache
+    {
+        ~Cache() noexcept
+        {
+            for (std::size_t i = 0; i < s_classCount; ++i)
+            {
+                while (m_pFreeBlocks[i])
+                {
+                    auto pBlock = m_pFreeBlocks[i];
+                    m_pFreeBlocks[i] = pBlock->m_pNext;
+
+                    std::pmr::new_delete_resource()->deallocate(pBlock, (i + 1) * s_classSize);
+                }
+            }
+
+            s_destroyed = true;
+        }
+
+        std::array<FreeBlock*, s_classCount> m_pFreeBlocks = {};
+        std::array<std::size_t, s_classCount> m_counts = {};
+    };
+
+    /**
+     *  @brief Get the cache of the calling thread.
+     *
+     *  @returns The cache, or nullptr during thread exit.
+     */
+    static Cache*
+    GetCache() noexcept
+    {
+        thread_local Cache s_cache;
+
+        // Tasks may still be destroyed by other thread local destructors
+        return s_destroyed ? nullptr : &s_cache;
+    }
+
+    /**
+     *  @brief Get the size class of a block.
+     *
+     *  @param bytes The block size.
+     *  @param alignment The block alignment.
+     *
+     *  @returns The size class, or the class count if not cached.
+     */
+    static std::size_t
+    GetClass(std::size_t bytes, std::size_t alignment) noexcept
+    {
+        if (bytes == 0 || bytes > s_classSize * s_classCount || alignment > alignof(std::max_align_t))
+        {
+            return s_classCount;
+        }
+
+        return (bytes - 1) / s_classSize;
+    }
+
+    void*
+    do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        auto sizeClass = GetClass(bytes, alignment);
+
+        if (sizeClass == s_classCount)
+        {
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        auto pCache = GetCache();
+
+        if (pCache && pCache->m_pFreeBlocks[sizeClass])
+        {
+            auto pBlock = pCache->m_pFreeBlocks[sizeClass];
+            pCache->m_pFreeBlocks[sizeClass] = pBlock->m_pNext;
+            --pCache->m_counts[sizeClass];
+
+            return pBlock;
+        }
+
+        // Blocks of a class share one size, any of them can be reused for it
+        return std::pmr::new_delete_resource()->allocate((sizeClass + 1) * s_classSize);
+    }
+
+    void
+    do_deallocate(void* pMemory, std::size_t bytes, std::size_t alignment) override
+    {
+        auto sizeClass = GetClass(bytes, alignment);
+
+        if (sizeClass == s_classCount)
+        {
+            std::pmr::new_delete_resource()->deallocate(pMemory, bytes, alignment);
+            return;
+        }
+
+        auto pCache = GetCache();
+
+        if (!pCache || pCache->m_counts[sizeClass] >= libcpptask_TASK_ALLOCATOR_CACHE_SIZE)
+        {
+            std::pmr::new_delete_resource()->deallocate(pMemory, (sizeClass + 1) * s_classSize);
+            return;
+        }
+
+        auto pBlock = static_cast<FreeBlock*>(pMemory);
+        pBlock->m_pNext = pCache->m_pFreeBlocks[sizeClass];
+        pCache->m_pFreeBlocks[sizeClass] = pBlock;
+        ++pCache->m_counts[sizeClass];
+    }
+
+    bool
+    do_is_equal(const std::pmr::memory_resource& c_rOther) const noexcept override
+    {
+        return this == &c_rOther;
+    }
+
+    static thread_local bool s_destroyed;
+};
+
+thread_local bool ThreadCacheResource::s_destroyed = false;
+
+//******************************************************************************
+// MARK: Memory Resource
+//******************************************************************************
+
+/**
+ *  @brief The header in front of every control block, remembering the 
+ *         resource it was allocated from. Keeps the control block aligned.
+ */
+struct alignas(std::max_align_t) BlockHeader
+{
+    std::pmr::memory_resource* m_pResource;
+};
+
+static std::atomic<std::pmr::memory_resource*> s_pMemoryResource(nullptr);
+
+void
+TaskAllocator::SetMemoryResource(std::pmr::memory_resource* pResource) noexcept
+{
+    s_pMemoryResource.store(pResource, std::memory_order_release);
+}
+
+std::pmr::memory_resource*
+TaskAllocator::GetMemoryResource() noexcept
+{
+    auto pResource = s_pMemoryResource.load(std::memory_order_acquire);
+
+    return pResource ? pResource : std::pmr::new_delete_resource();
+}
+
+std::pmr::memory_resource*
+TaskAllocator::ThreadCache() noexcept
+{
+    static ThreadCacheResource s_threadCache;
+
+    return &s_threadCache;
+}
+
+//******************************************************************************
+// MARK: Allocate
+//******************************************************************************
+
+void*
+TaskAllocator::Allocate(std::size_t size)
+{
+    auto pResource = GetMemoryResource();
+    auto pHeader = static_cast<BlockHeader*>(pResource->allocate(sizeof(BlockHeader) + size, alignof(BlockHeader)));
+
+    pHeader->m_pResource = pResource;
+
+    return pHeader + 1;
+}
+
+void
+TaskAllocator::Deallocate(void* pMemory, std::size_t size) noexcept
+{
+    if (!pMemory)
+    {
+        return;
+    }
+
+    auto pHeader = static_cast<BlockHeader*>(pMemory) - 1;
+
+    pHeader->m_pResource->deallocate(pHeader, sizeof(BlockHeader) + size, alignof(BlockHeader));
+}
+
+// Namespace
+}
@@ -0,0 +1,335 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// STL
+
+// External
+
+// Project
+#include "../include/libcpptask/CppTask_TaskGraph.h"
+
+
+// Namespace
+namespace CppTask {
+
+//******************************************************************************
+// MARK: Graph Node Control Block
+//******************************************************************************
+
+void
+GraphNodeControlBlock::Execute()
+{
+    auto pGraph = m_pGraph;
+
+    // Nodes of a faulted run only pass the run on to their successors
+    if (!pGraph->IsFaulted())
+    {
+        try
+        {
+            m_function();
+        }
+        catch (...)
+        {
+            pGraph->Fault(std::current_exception());
+        }
+    }
+
+    // Done before the run completes, finished nodes may be reset right away
+    SetFinished();
+
+    for (auto pSuccessor : m_successors)
+    {
+        if (pSuccessor->m_pendingCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            pGraph->Schedule(pSuccessor);
+        }
+    }
+
+    // The graph may be run again or destroyed once the last node completed
+    pGraph->CompleteNode();
+}
+
+//******************************************************************************
+// MARK: Constructor / Destructor
+//******************************************************************************
+
+TaskGraph::TaskGraph()
+: m_pCompletion(new GraphCompletionControlBlock()),
+  m_validated(false),
+  m_pPool(nullptr),
+  m_remaining(0),
+  m_faulted(false)
+{}
+
+TaskGraph::~TaskGraph() noexcept
+{
+    Await();
+}
+
+//******************************************************************************
+// MARK: Declare Graph
+//******************************************************************************
+
+TaskGraph::NodeId
+TaskGraph::AddNode(MoveOnlyFunction<void()> function, TaskPriority priority)
+{
+    if (!function)
+    {
+        throw Exception("Invalid parameters!");
+    }
+    else if (GetState() == TaskState::RUNNING)
+    {
+        throw Exception("Attempted to change a running task graph!");
+    }
+
+    IntrusivePointer<GraphNodeControlBlock> pNode(new GraphNodeControlBlock(this, m_nodes.size(), std::move(function)));
+    pNode->SetPriority(priority);
+
+    m_nodes.emplace_back(std::move(pNode));
+    m_validated = false;
+
+    return m_nodes.size() - 1;
+}
+
+void
+TaskGraph::AddEdge(NodeId from, NodeId to)
+{
+    if (from >= m_nodes.size() || to >= m_nodes.size() || from == to)
+    {
+        throw Exception("Invalid parameters!");
+    }
+    else if (GetState() == TaskState::RUNNING)
+    {
+        throw Exception("Attempted to change a running task graph!");
+    }
+
+    m_nodes[from]->m_successors.emplace_back(m_nodes[to].get());
+    ++m_nodes[to]->m_inputCount;
+    m_validated = false;
+}
+
+//******************************************************************************
+// MARK: Run Graph
+//******************************************************************************
+
+void
+TaskGraph::Run()
+{
+    RunAsync();
+    AwaitResult();
+}
+
+void
+TaskGraph::RunAsync()
+{
+    Start(nullptr);
+}
+
+void
+TaskGraph::RunAsync(Pool& rPool)
+{
+    Start(&rPool);
+}
+
+void
+TaskGraph::Start(Pool* pPool)
+{
+    if (GetState() == TaskState::RUNNING)
+    {
+        throw Exception("Attempted to run a task graph which is still running!");
+    }
+
+    if (!m_validated)
+    {
+        Validate();
+    }
+
+    // Nothing of the previous run is left running once it completed
+    for (auto& rpNode : m_nodes)
+    {
+        rpNode->Reset();
+        rpNode->m_pendingCount.store(rpNode->m_inputCount, std::memory_order_relaxed);
+    }
+
+    m_pCompletion->Reset();
+    m_pPool = pPool;
+    m_pException = nullptr;
+    m_faulted.store(false, std::memory_order_relaxed);
+    m_remaining.store(m_nodes.size(), std::memory_order_relaxed);
+
+    if (m_nodes.empty())
+    {
+        m_pCompletion->SetFinished();
+        return;
+    }
+
+    m_pCompletion->m_state.store(TaskState::RUNNING, std::memory_order_release);
+
+    // The enqueue publishes the reset nodes to the pool threads
+    for (auto pRoot : m_roots)
+    {
+        Schedule(pRoot);
+    }
+}
+
+void
+TaskGraph::Validate()
+{
+    std::vector<size_t> inputCounts(m_nodes.size());
+    std::vector<NodeId> order;
+    order.reserve(m_nodes.size());
+
+    for (NodeId id = 0; id < m_nodes.size(); ++id)
+    {
+        inputCounts[id] = m_nodes[id]->m_inputCount;
+
+        if (inputCounts[id] == 0)
+        {
+            order.emplace_back(id);
+        }
+    }
+
+    auto rootCount = order.size();
+
+    // Visit the nodes in dependency order, nodes on a cycle are never reached
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        for (auto pSuccessor : m_nodes[order[i]]->m_successors)
+        {
+            if (--inputCounts[pSuccessor->m_id] == 0)
+            {
+                order.emplace_back(pSuccessor->m_id);
+            }
+        }
+    }
+
+    if (order.size() != m_nodes.size())
+    {
+        throw Exception("Task graph contains a cycle!");
+    }
+
+    m_roots.clear();
+
+    for (size_t i = 0; i < rootCount; ++i)
+    {
+        m_roots.emplace_back(m_nodes[order[i]].get());
+    }
+
+    m_validated = true;
+}
+
+void
+TaskGraph::Schedule(GraphNodeControlBlock* pNode) noexcept
+{
+    IntrusivePointer<TaskThread> pTaskThread(pNode);
+
+    try
+    {
+        if (m_pPool)
+        {
+            TaskThread::Enqueue(pTaskThread, *m_pPool);
+        }
+        else
+        {
+            TaskThread::Enqueue(pTaskThread);
+        }
+
+        return;
+    }
+    catch (...)
+    {
+        Fault(std::current_exception());
+    }
+
+    // The run has to go on for the graph to complete, the faulted run skips 
+    // the node function
+    pNode->Run();
+}
+
+void
+TaskGraph::Fault(std::exception_ptr pException) noexcept
+{
+    std::lock_guard<std::mutex> lockGuard(m_exceptionMutex);
+
+    if (!m_pException)
+    {
+        m_pException = std::move(pException);
+        m_faulted.store(true, std::memory_order_release);
+    }
+}
+
+void
+TaskGraph::CompleteNode() noexcept
+{
+    if (m_remaining.fetch_sub(1, std::memory_order_acq_rel) != 1)
+    {
+        return;
+    }
+
+    std::exception_ptr pException;
+
+    {
+        std::lock_guard<std::mutex> lockGuard(m_exceptionMutex);
+        pException = m_pException;
+    }
+
+    if (pException)
+    {
+        m_pCompletion->SetFaulted(std::move(pException));
+    }
+    else
+    {
+        m_pCompletion->SetFinished();
+    }
+}
+
+//******************************************************************************
+// MARK: Await Graph
+//******************************************************************************
+
+void
+TaskGraph::Await() const
+{
+    if (GetState() != TaskState::RUNNING)
+    {
+        return;
+    }
+
+    m_pCompletion->Await();
+}
+
+bool
+TaskGraph::AwaitFor(std::chrono::nanoseconds waitTime) const
+{
+    if (GetState() != TaskState::RUNNING)
+    {
+        return true;
+    }
+
+    return m_pCompletion->AwaitUntil(std::chrono::steady_clock::now() + waitTime);
+}
+
+void
+TaskGraph::AwaitResult() const
+{
+    Await();
+
+    m_pCompletion->RethrowIfFaulted();
+}
+
+// Namespace
+}
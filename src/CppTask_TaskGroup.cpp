@@ -0,0 +1,260 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+// STL
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+
+// External
+
+// Project
+#include "../include/libcpptask/CppTask_TaskGroup.h"
+#include "../include/libcpptask/CppTask_Task.h"
+#include "../include/libcpptask/CppTask_Pool.h"
+
+
+// Namespace
+namespace CppTask {
+
+//******************************************************************************
+// MARK: Task Group State
+//******************************************************************************
+
+/**
+ *  @brief The task group state is shared by the group and the pool helpers
+ *         of its children. Helpers which start after their child was taken
+ *         by another thread only touch this state.
+ */
+struct TaskGroupState
+{
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    std::deque<MoveOnlyFunction<void()>> m_functions;
+    size_t m_pendingCount = 0;
+    std::exception_ptr m_pException;
+};
+
+//******************************************************************************
+// MARK: Run Child
+//******************************************************************************
+
+/**
+ *  @brief Take a child which was not started yet and run it.
+ *
+ *  @param rState The task group state.
+ *  @param newest True to take the newest child, false to take the oldest.
+ *
+ *  @returns True if a child was run, false if none was left.
+ */
+static bool
+RunChild(TaskGroupState& rState, bool newest) noexcept
+{
+    MoveOnlyFunction<void()> function;
+
+    {
+        std::lock_guard<std::mutex> lockGuard(rState.m_mutex);
+
+        if (rState.m_functions.empty())
+        {
+            return false;
+        }
+
+        if (newest)
+        {
+            function = std::move(rState.m_functions.back());
+            rState.m_functions.pop_back();
+        }
+        else
+        {
+            function = std::move(rState.m_functions.front());
+            rState.m_functions.pop_front();
+        }
+    }
+
+    std::exception_ptr pException;
+
+    try
+    {
+        function();
+    }
+    catch (...)
+    {
+        pException = std::current_exception();
+    }
+
+    // Captures are released before the child counts as done, the waiting 
+    // scope may own what they refer to
+    function = nullptr;
+
+    std::deque<MoveOnlyFunction<void()>> skipped;
+
+    if (pException)
+    {
+        std::lock_guard<std::mutex> lockGuard(rState.m_mutex);
+
+        if (!rState.m_pException)
+        {
+            rState.m_pException = std::move(pException);
+            skipped.swap(rState.m_functions);
+        }
+    }
+
+    // The same goes for the captures of the children skipped, they still
+    // count as pending until released
+    auto doneCount = skipped.size() + 1;
+    skipped.clear();
+
+    std::lock_guard<std::mutex> lockGuard(rState.m_mutex);
+
+    rState.m_pendingCount -= doneCount;
+
+    if (rState.m_pendingCount == 0)
+    {
+        rState.m_condition.notify_all();
+    }
+
+    return true;
+}
+
+//******************************************************************************
+// MARK: Constructor / Destructor
+//******************************************************************************
+
+TaskGroup::TaskGroup()
+: m_pState(std::make_shared<TaskGroupState>()),
+  m_pPool(nullptr)
+{}
+
+TaskGroup::TaskGroup(Pool& rPool)
+: m_pState(std::make_shared<TaskGroupState>()),
+  m_pPool(&rPool)
+{}
+
+TaskGroup::~TaskGroup() noexcept
+{
+    try
+    {
+        Wait();
+    }
+    catch (...)
+    {}
+}
+
+//******************************************************************************
+// MARK: Spawn
+//******************************************************************************
+
+void
+TaskGroup::Spawn(MoveOnlyFunction<void()> function, TaskPriority priority)
+{
+    if (!function)
+    {
+        throw Exception("Invalid parameters!");
+    }
+
+    {
+        std::lock_guard<std::mutex> lockGuard(m_pState->m_mutex);
+
+        m_pState->m_functions.emplace_back(std::move(function));
+        ++m_pState->m_pendingCount;
+
+        // Wake a waiting thread to run the child itself
+        m_pState->m_condition.notify_all();
+    }
+
+    // The helper runs whichever child is the oldest once it starts, if the
+    // waiting thread has not taken them all by then
+    Task<void> helper([pState = m_pState](){
+        RunChild(*pState, false);
+    }, priority);
+
+    try
+    {
+        if (m_pPool)
+        {
+            helper.RunAsync(*m_pPool);
+        }
+        else
+        {
+            helper.RunAsync();
+        }
+    }
+    catch (const Exception&)
+    {
+        // A full pool rejected the helper, the child stays queued and is run
+        // by Wait() instead
+    }
+}
+
+//******************************************************************************
+// MARK: Wait
+//******************************************************************************
+
+void
+TaskGroup::Wait()
+{
+    auto& rState = *m_pState;
+
+    while (true)
+    {
+        // Newest first, the children most likely still in cache
+        while (RunChild(rState, true))
+        {}
+
+        std::unique_lock<std::mutex> uniqueLock(rState.m_mutex);
+
+        if (rState.m_pendingCount == 0)
+        {
+            break;
+        }
+        else if (!rState.m_functions.empty())
+        {
+            continue;
+        }
+
+        // Only children running on other threads are left, they may still 
+        // spawn more children for us to run
+        uniqueLock.unlock();
+        BlockingRegion blockingRegion;
+        uniqueLock.lock();
+
+        rState.m_condition.wait(uniqueLock, [&rState](){
+            return rState.m_pendingCount == 0 || !rState.m_functions.empty();
+        });
+
+        if (rState.m_pendingCount == 0)
+        {
+            break;
+        }
+    }
+
+    std::exception_ptr pException;
+
+    {
+        std::lock_guard<std::mutex> lockGuard(rState.m_mutex);
+        pException.swap(rState.m_pException);
+    }
+
+    if (pException)
+    {
+        std::rethrow_exception(pException);
+    }
+}
+
+// Namespace
+}
@@ -16,13 +16,25 @@
  */
 
 // STL
+#include <algorithm>
 #include <iostream>
+#include <limits>
+#include <string>
 #include <thread>
 
+#if defined(__linux__)
+    #include <pthread.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #include <immintrin.h>
+#endif
+
 // External
 
 // Project
 #include "./CppTask_ThreadPool.h"
+#include "./CppTask_Tracer.h"
 
 
 #ifdef libcpptask_THREAD_POOL_FORCED_THREAD_COUNT
@@ -31,19 +43,146 @@
     #endif
 #endif
 
+#ifndef libcpptask_THREAD_POOL_INJECTION_QUEUE_CAPACITY
+    #define libcpptask_THREAD_POOL_INJECTION_QUEUE_CAPACITY 4096
+#endif
+
+#if libcpptask_THREAD_POOL_INJECTION_QUEUE_CAPACITY < (2) || \
+    (libcpptask_THREAD_POOL_INJECTION_QUEUE_CAPACITY & (libcpptask_THREAD_POOL_INJECTION_QUEUE_CAPACITY - 1)) != (0)
+    #error "Invalid task thread pool injection queue capacity, has to be a power of two!"
+#endif
+
+#define libcpptask_QUEUE_FULL_BLOCK 0
+#define libcpptask_QUEUE_FULL_SPIN 1
+#define libcpptask_QUEUE_FULL_THROW 2
+
+#ifndef libcpptask_THREAD_POOL_INJECTION_QUEUE_FULL_POLICY
+    #define libcpptask_THREAD_POOL_INJECTION_QUEUE_FULL_POLICY libcpptask_QUEUE_FULL_BLOCK
+#endif
+
+#if libcpptask_THREAD_POOL_INJECTION_QUEUE_FULL_POLICY < (0) || \
+    libcpptask_THREAD_POOL_INJECTION_QUEUE_FULL_POLICY > (2)
+    #error "Invalid task thread pool injection queue full policy!"
+#endif
+
+#ifndef libcpptask_THREAD_POOL_PRIORITY_AGING
+    #define libcpptask_THREAD_POOL_PRIORITY_AGING 16
+#endif
+
+#if libcpptask_THREAD_POOL_PRIORITY_AGING < (2)
+    #error "Invalid task thread pool priority aging, has to be at least two!"
+#endif
+
 
 // Namespace
 namespace CppTask {
 
+//******************************************************************************
+// MARK: Pause
+//******************************************************************************
+
+/**
+ *  @brief Hint the CPU that we are spinning, reducing the power used and the
+ *         penalty when leaving the spin loop.
+ */
+static inline void
+Pause() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__("yield");
+#endif
+}
+
+//******************************************************************************
+// MARK: Metrics
+//******************************************************************************
+
+/**
+ *  @brief Add to a counter only written by the calling thread, without the
+ *         cost of an atomic read-modify-write.
+ *
+ *  @param rCounter The counter to add to.
+ *  @param value The value to add.
+ */
+template <typename T>
+static inline void
+Add(std::atomic<T>& rCounter, T value) noexcept
+{
+    rCounter.store(rCounter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+/**
+ *  @brief Get the latency histogram bucket of a duration.
+ *
+ *  @param duration The duration.
+ *
+ *  @returns The bucket index.
+ */
+static inline size_t
+GetBucket(std::chrono::nanoseconds duration) noexcept
+{
+    auto microseconds = static_cast<unsigned long long>(std::max<std::int64_t>(duration.count() / 1000, 0));
+
+    if (microseconds == 0)
+    {
+        return 0;
+    }
+
+#if defined(__GNUC__) || defined(__clang__)
+    size_t bucket = 64 - __builtin_clzll(microseconds);
+#else
+    size_t bucket = 0;
+
+    for (; microseconds > 0; microseconds >>= 1)
+    {
+        ++bucket;
+    }
+#endif
+
+    return std::min<size_t>(bucket, LatencyHistogram::s_bucketCount - 1);
+}
+
+//******************************************************************************
+// MARK: Current Worker
+//******************************************************************************
+
+thread_local ThreadPool* ThreadPool::s_pCurrentThreadPool = nullptr;
+thread_local ThreadPool::Worker* ThreadPool::s_pCurrentWorker = nullptr;
+
 //******************************************************************************
 // MARK: Constructor / Destructor
 //******************************************************************************
 
-ThreadPool::ThreadPool()
-: m_runThreads(true)
+ThreadPool::ThreadPool(const PoolOptions& c_rOptions)
+: m_options(c_rOptions),
+  m_runThreads(true),
+  m_pendingCount(0),
+  m_sleepingCount(0),
+  m_blockedCount(0),
+  m_spinningCount(0),
+  m_idleSpinCount(c_rOptions.m_idleSpinCount),
+  m_idleYieldCount(c_rOptions.m_idleYieldCount),
+  m_spinningLimit(0),
+  m_inlineThreshold(c_rOptions.m_inlineThreshold),
+  m_elastic(c_rOptions.m_maxThreadCount > 0),
+  m_targetCount(0),
+  m_activeCount(0),
+  m_blockingCount(0),
+  m_dequeuedCount(0),
+  m_submittedCount(0),
+  m_pTimerTarget(std::make_shared<TimerTarget>())
 {
+    m_pTimerTarget->m_pThreadPool = this;
+
+    for (auto& rPendingCount : m_lanePendingCounts)
+    {
+        rPendingCount = 0;
+    }
+
 #ifndef libcpptask_THREAD_POOL_FORCED_THREAD_COUNT
-    auto threadCount = std::thread::hardware_concurrency();
+    size_t threadCount = std::thread::hardware_concurrency();
 
     // Always keep one thread completely free, and create at least one
     // We want to keep concurrency as healthy as possible
@@ -55,26 +194,123 @@ ThreadPool::ThreadPool()
     {
         --threadCount;
     }
-
-    for (size_t i = 0; i < threadCount; ++i)
 #else
-    for (size_t i = 0; i < libcpptask_THREAD_POOL_FORCED_THREAD_COUNT; ++i)
+    size_t threadCount = libcpptask_THREAD_POOL_FORCED_THREAD_COUNT;
 #endif
+
+    if (c_rOptions.m_threadCount > 0)
+    {
+        threadCount = c_rOptions.m_threadCount;
+    }
+
+    // Elastic pools start within their limits and have a worker for each
+    // thread they may grow to
+    size_t workerCount = threadCount;
+
+    if (m_elastic)
+    {
+        if (c_rOptions.m_minThreadCount > c_rOptions.m_maxThreadCount)
+        {
+            throw Exception("Invalid parameters!");
+        }
+
+        threadCount = std::clamp(threadCount, c_rOptions.m_minThreadCount, c_rOptions.m_maxThreadCount);
+        workerCount = c_rOptions.m_maxThreadCount;
+    }
+
+    m_targetCount = threadCount;
+
+    // Pools which are not NUMA aware put everything on a single node,
+    // NUMA aware pools never use more nodes than workers
+    auto nodeCpus = c_rOptions.m_numaAware ? Topology::GetNodeCpus() : std::vector<std::vector<size_t>>(1);
+
+    if (nodeCpus.size() > workerCount)
+    {
+        nodeCpus.resize(workerCount);
+    }
+
+    for (auto& rCpus : nodeCpus)
     {
-        m_threads.emplace_back(RunThread, this);
+        m_nodes.emplace_back(std::make_unique<Node>(libcpptask_THREAD_POOL_INJECTION_QUEUE_CAPACITY));
+        m_nodes.back()->m_cpus = std::move(rCpus);
+
+        for (auto cpu : m_nodes.back()->m_cpus)
+        {
+            if (cpu >= m_cpuNodes.size())
+            {
+                m_cpuNodes.resize(cpu + 1, 0);
+            }
+
+            m_cpuNodes[cpu] = m_nodes.size() - 1;
+        }
+    }
+
+    m_spinningLimit = std::max<size_t>(workerCount / 2, 1);
+
+    // Create all workers before starting any thread, workers steal from
+    // each other and expect the worker list to be complete
+    for (size_t i = 0; i < workerCount; ++i)
+    {
+        m_workers.emplace_back(std::make_unique<Worker>());
+        m_workers.back()->m_index = i;
+        m_workers.back()->m_nodeIndex = i % m_nodes.size();
+    }
+
+    {
+        std::lock_guard<std::mutex> lockGuard(m_workerMutex);
+
+        for (size_t i = 0; i < threadCount; ++i)
+        {
+            StartThread(*m_workers[i]);
+        }
+    }
+
+    if (m_elastic)
+    {
+        m_monitorThread = std::thread(RunMonitor, this);
     }
 }
 
 ThreadPool::~ThreadPool() noexcept
 {
+    // Timers firing from now on find nothing to enqueue onto
+    {
+        std::lock_guard<std::mutex> lockGuard(m_pTimerTarget->m_mutex);
+        m_pTimerTarget->m_pThreadPool = nullptr;
+    }
+
     {
         std::lock_guard<std::mutex> lockGuard(m_mutex);
 
         m_runThreads = false;
         m_condition.notify_all();
+        m_spaceCondition.notify_all();
+    }
+
+    {
+        std::lock_guard<std::mutex> lockGuard(m_workerMutex);
+        m_monitorCondition.notify_all();
+    }
+
+    if (m_monitorThread.joinable())
+    {
+        m_monitorThread.join();
+    }
+
+    // No threads are started once stopped, but workers may still try while
+    // finishing their current task and need the worker mutex for it
+    std::vector<std::thread> threads;
+
+    {
+        std::lock_guard<std::mutex> lockGuard(m_workerMutex);
+
+        for (auto& rWorker : m_workers)
+        {
+            threads.emplace_back(std::move(rWorker->m_thread));
+        }
     }
 
-    for (auto& rThread : m_threads)
+    for (auto& rThread : threads)
     {
         if (rThread.joinable())
         {
@@ -90,76 +326,755 @@ ThreadPool::~ThreadPool() noexcept
 ThreadPool&
 ThreadPool::Singleton()
 {
-    static ThreadPool s_threadPool;
+    static ThreadPool s_threadPool { PoolOptions() };
     return s_threadPool;
 }
+
+ThreadPool&
+ThreadPool::Current()
+{
+    return s_pCurrentThreadPool ? *s_pCurrentThreadPool : Singleton();
+}
+
+ThreadPool*
+ThreadPool::CurrentWorkerPool() noexcept
+{
+    return s_pCurrentThreadPool;
+}
+
+size_t
+ThreadPool::CurrentWorkerIndex() noexcept
+{
+    return s_pCurrentWorker ? s_pCurrentWorker->m_index : Pool::s_noWorkerIndex;
+}
     
 //******************************************************************************
 // MARK: Enqueue
 //******************************************************************************
 
 void
-ThreadPool::Enqueue(std::shared_ptr<TaskThread> pTaskThread)
+ThreadPool::Enqueue(IntrusivePointer<TaskThread> pTaskThread, TaskPriority priority)
 {
     if (!pTaskThread)
     {
         throw Exception("Invalid parameters!");
     }
 
-    std::lock_guard<std::mutex> lockGuard(m_mutex);
+    if (!m_runThreads)
+    {
+        throw Exception("Thread pool is stopped!");
+    }
+
+    auto lane = std::min<size_t>(priority, s_laneCount - 1);
+
+    libcpptask_TRACE(TraceEventType::ENQUEUE, pTaskThread.get());
+    pTaskThread->m_enqueueTime = std::chrono::steady_clock::now();
+
+    if (s_pCurrentThreadPool == this)
+    {
+        // Submissions from our own workers stay local to that worker
+        std::lock_guard<std::mutex> lockGuard(s_pCurrentWorker->m_mutex);
+        s_pCurrentWorker->m_taskThreads[lane].emplace_back(std::move(pTaskThread));
+    }
+    else
+    {
+        Inject(pTaskThread, lane);
+    }
+
+    ++m_lanePendingCounts[lane];
+    ++m_pendingCount;
+    m_submittedCount.fetch_add(1, std::memory_order_relaxed);
+    Notify();
+}
+
+void
+ThreadPool::EnqueueAll(std::vector<IntrusivePointer<TaskThread>>& rTaskThreads, 
+                       const std::vector<TaskPriority>& c_rPriorities)
+{
+    if (rTaskThreads.size() != c_rPriorities.size())
+    {
+        throw Exception("Invalid parameters!");
+    }
 
     if (!m_runThreads)
     {
         throw Exception("Thread pool is stopped!");
     }
 
-    m_taskThreads.emplace_back(pTaskThread);
-    m_condition.notify_one();
+    std::array<size_t, s_laneCount> laneCounts = {};
+    size_t count = 0;
+    auto enqueueTime = std::chrono::steady_clock::now();
+
+    // Publish whatever made it into the queues, even if a push failed
+    auto publish = [this, &laneCounts, &count](){
+        for (size_t lane = 0; lane < s_laneCount; ++lane)
+        {
+            if (laneCounts[lane] > 0)
+            {
+                m_lanePendingCounts[lane] += laneCounts[lane];
+            }
+        }
+
+        if (count > 0)
+        {
+            m_pendingCount += count;
+            m_submittedCount.fetch_add(count, std::memory_order_relaxed);
+            Notify(count);
+        }
+    };
+
+    try
+    {
+        if (s_pCurrentThreadPool == this)
+        {
+            // Submissions from our own workers stay local to that worker
+            std::lock_guard<std::mutex> lockGuard(s_pCurrentWorker->m_mutex);
+
+            for (size_t i = 0; i < rTaskThreads.size(); ++i)
+            {
+                auto lane = std::min<size_t>(c_rPriorities[i], s_laneCount - 1);
+
+                libcpptask_TRACE(TraceEventType::ENQUEUE, rTaskThreads[i].get());
+                rTaskThreads[i]->m_enqueueTime = enqueueTime;
+                s_pCurrentWorker->m_taskThreads[lane].emplace_back(std::move(rTaskThreads[i]));
+                ++laneCounts[lane];
+                ++count;
+            }
+        }
+        else
+        {
+            for (size_t i = 0; i < rTaskThreads.size(); ++i)
+            {
+                auto lane = std::min<size_t>(c_rPriorities[i], s_laneCount - 1);
+
+                libcpptask_TRACE(TraceEventType::ENQUEUE, rTaskThreads[i].get());
+                rTaskThreads[i]->m_enqueueTime = enqueueTime;
+                Inject(rTaskThreads[i], lane);
+                ++laneCounts[lane];
+                ++count;
+            }
+        }
+    }
+    catch (...)
+    {
+        publish();
+        throw;
+    }
+
+    publish();
+}
+
+void
+ThreadPool::Inject(IntrusivePointer<TaskThread>& rTaskThread, size_t lane)
+{
+    auto nodeIndex = GetCurrentNode();
+
+    // Prefer the node we run on, but use any other node before applying
+    // the full queue policy
+    for (size_t i = 0; i < m_nodes.size(); ++i)
+    {
+        if (m_nodes[(nodeIndex + i) % m_nodes.size()]->m_taskThreads[lane]->TryPush(rTaskThread))
+        {
+            return;
+        }
+    }
+
+#if libcpptask_THREAD_POOL_INJECTION_QUEUE_FULL_POLICY == libcpptask_QUEUE_FULL_THROW
+    throw Exception("Thread pool queue is full!");
+#elif libcpptask_THREAD_POOL_INJECTION_QUEUE_FULL_POLICY == libcpptask_QUEUE_FULL_SPIN
+    auto& rTaskThreads = *m_nodes[nodeIndex]->m_taskThreads[lane];
+
+    while (!rTaskThreads.TryPush(rTaskThread))
+    {
+        if (!m_runThreads)
+        {
+            throw Exception("Thread pool is stopped!");
+        }
+
+        std::this_thread::yield();
+    }
+#else
+    auto& rTaskThreads = *m_nodes[nodeIndex]->m_taskThreads[lane];
+    std::unique_lock<std::mutex> uniqueLock(m_mutex);
+
+    // Workers check the blocked count after every pop from the injection
+    // queue, the retry after registering ensures we do not miss a free slot.
+    // Waiting on a single node is fine, other workers drain it eventually
+    ++m_blockedCount;
+
+    while (!rTaskThreads.TryPush(rTaskThread))
+    {
+        if (!m_runThreads)
+        {
+            --m_blockedCount;
+            throw Exception("Thread pool is stopped!");
+        }
+
+        m_spaceCondition.wait(uniqueLock);
+    }
+
+    --m_blockedCount;
+#endif
+}
+
+size_t
+ThreadPool::GetCurrentNode() const noexcept
+{
+    if (m_nodes.size() == 1)
+    {
+        return 0;
+    }
+
+    if (s_pCurrentThreadPool == this)
+    {
+        return s_pCurrentWorker->m_nodeIndex;
+    }
+
+    auto cpu = Topology::GetCurrentCpu();
+
+    if (cpu < 0 || static_cast<size_t>(cpu) >= m_cpuNodes.size())
+    {
+        return 0;
+    }
+
+    return m_cpuNodes[cpu];
 }
 
 //******************************************************************************
-// MARK: Run Thread
+// MARK: Getters
+//******************************************************************************
+
+size_t
+ThreadPool::GetThreadCount() const noexcept
+{
+    return m_activeCount;
+}
+
+bool
+ThreadPool::IsSaturated() const noexcept
+{
+    // A pending count wrapped below zero for a moment is not saturated
+    auto pendingCount = m_pendingCount.load(std::memory_order_relaxed);
+
+    return m_inlineThreshold > 0 && 
+           pendingCount >= m_inlineThreshold && 
+           pendingCount <= std::numeric_limits<size_t>::max() / 2;
+}
+
+PoolMetrics
+ThreadPool::GetMetrics() const
+{
+    PoolMetrics metrics;
+    metrics.m_queuedCount = m_pendingCount;
+    metrics.m_submittedCount = m_submittedCount.load(std::memory_order_relaxed);
+    metrics.m_busyTimes.reserve(m_workers.size());
+
+    // The worker list never changes after construction, workers of elastic
+    // pools keep their counters while retired
+    for (const auto& c_rpWorker : m_workers)
+    {
+        const auto& c_rMetrics = c_rpWorker->m_metrics;
+
+        metrics.m_completedCount += c_rMetrics.m_completedCount.load(std::memory_order_relaxed);
+        metrics.m_failedCount += c_rMetrics.m_failedCount.load(std::memory_order_relaxed);
+        metrics.m_cancelledCount += c_rMetrics.m_cancelledCount.load(std::memory_order_relaxed);
+        metrics.m_busyTimes.emplace_back(c_rMetrics.m_busyTime.load(std::memory_order_relaxed));
+
+        for (size_t i = 0; i < LatencyHistogram::s_bucketCount; ++i)
+        {
+            metrics.m_queueWaitHistogram.m_buckets[i] += c_rMetrics.m_queueWaitBuckets[i].load(std::memory_order_relaxed);
+            metrics.m_runTimeHistogram.m_buckets[i] += c_rMetrics.m_runTimeBuckets[i].load(std::memory_order_relaxed);
+        }
+
+        if (c_rMetrics.m_busy.load(std::memory_order_relaxed))
+        {
+            ++metrics.m_busyThreadCount;
+        }
+        else if (c_rpWorker->m_active)
+        {
+            ++metrics.m_idleThreadCount;
+        }
+    }
+
+    return metrics;
+}
+
+//******************************************************************************
+// MARK: Blocking
+//******************************************************************************
+
+void
+ThreadPool::BeginBlocking() noexcept
+{
+    auto blockingCount = ++m_blockingCount;
+
+    // Keep as many unblocked workers as the pool was started with
+    if (m_elastic && m_activeCount < m_targetCount + blockingCount)
+    {
+        StartWorker();
+    }
+}
+
+void
+ThreadPool::EndBlocking() noexcept
+{
+    // Surplus workers retire once they are idle for long enough
+    --m_blockingCount;
+}
+
+//******************************************************************************
+// MARK: Dequeue
+//******************************************************************************
+
+IntrusivePointer<TaskThread>
+ThreadPool::Dequeue(Worker& rWorker)
+{
+    IntrusivePointer<TaskThread> pTaskThread(nullptr);
+
+    // Every n-th dequeue starts with one of the lower lanes, rotating
+    // through them, so a busy high lane can not starve the others
+    size_t firstLane = s_laneCount - 1;
+
+    auto dequeueCount = rWorker.m_dequeueCount + 1;
+
+    if (dequeueCount % libcpptask_THREAD_POOL_PRIORITY_AGING == 0)
+    {
+        firstLane = (dequeueCount / libcpptask_THREAD_POOL_PRIORITY_AGING) % (s_laneCount - 1);
+    }
+
+    // The pending counts only skip lanes which are known to be empty
+    if (m_lanePendingCounts[firstLane] > 0)
+    {
+        pTaskThread = DequeueLane(rWorker, firstLane);
+    }
+
+    for (size_t lane = s_laneCount; !pTaskThread && lane-- > 0;)
+    {
+        if (lane != firstLane && m_lanePendingCounts[lane] > 0)
+        {
+            pTaskThread = DequeueLane(rWorker, lane);
+        }
+    }
+
+    // Only count successful dequeues, idle workers poll a lot
+    if (pTaskThread)
+    {
+        rWorker.m_dequeueCount = dequeueCount;
+    }
+
+    return pTaskThread;
+}
+
+IntrusivePointer<TaskThread>
+ThreadPool::DequeueLane(Worker& rWorker, size_t lane)
+{
+    IntrusivePointer<TaskThread> pTaskThread(nullptr);
+
+    // Local deque first, newest first for cache locality
+    {
+        std::lock_guard<std::mutex> lockGuard(rWorker.m_mutex);
+        auto& rTaskThreads = rWorker.m_taskThreads[lane];
+
+        if (!rTaskThreads.empty())
+        {
+            pTaskThread.swap(rTaskThreads.back());
+            rTaskThreads.pop_back();
+        }
+    }
+
+    // Injection queues second, own node first and oldest first to keep 
+    // external submissions FIFO
+    for (size_t i = 0; !pTaskThread && i < m_nodes.size(); ++i)
+    {
+        auto& rNode = *m_nodes[(rWorker.m_nodeIndex + i) % m_nodes.size()];
+
+        if (rNode.m_taskThreads[lane]->TryPop(pTaskThread) && m_blockedCount > 0)
+        {
+            std::lock_guard<std::mutex> lockGuard(m_mutex);
+            m_spaceCondition.notify_all();
+        }
+    }
+
+    // Steal from the other workers last, oldest first. The first pass only 
+    // steals from workers on our node, the second from all others
+    for (size_t i = 1; !pTaskThread && i < m_workers.size() * 2; ++i)
+    {
+        auto& rVictim = *m_workers[(rWorker.m_index + i) % m_workers.size()];
+        bool sameNode = rVictim.m_nodeIndex == rWorker.m_nodeIndex;
+
+        // Inactive workers have no local work, they only retire when idle
+        if (&rVictim == &rWorker || sameNode != (i < m_workers.size()) || !rVictim.m_active)
+        {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lockGuard(rVictim.m_mutex);
+        auto& rTaskThreads = rVictim.m_taskThreads[lane];
+
+        if (!rTaskThreads.empty())
+        {
+            pTaskThread.swap(rTaskThreads.front());
+            rTaskThreads.pop_front();
+        }
+    }
+
+    if (pTaskThread)
+    {
+        --m_lanePendingCounts[lane];
+        --m_pendingCount;
+
+        if (m_elastic)
+        {
+            m_dequeuedCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    return pTaskThread;
+}
+
+void
+ThreadPool::Notify(size_t count)
+{
+    // A spinning worker picks pending work up without being woken, and wakes
+    // another worker itself if more work is pending once it found some. 
+    // Enqueue increments the pending count before we check, a worker that 
+    // stops spinning to park sees our pending work if this skips the wakeup
+    size_t spinningCount = m_spinningCount;
+
+    if (spinningCount >= count)
+    {
+        return;
+    }
+
+    count -= spinningCount;
+
+    // Only touch the pool mutex if someone is actually sleeping. Workers
+    // register as sleeping before checking the pending count, so a worker
+    // will either see our pending task or be woken here
+    if (m_sleepingCount > 0)
+    {
+        std::lock_guard<std::mutex> lockGuard(m_mutex);
+
+        if (count >= m_sleepingCount)
+        {
+            m_condition.notify_all();
+            return;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            m_condition.notify_one();
+        }
+    }
+}
+
+//******************************************************************************
+// MARK: Idle
+//******************************************************************************
+
+bool
+ThreadPool::StartSpinning() noexcept
+{
+    if (m_idleSpinCount == 0 && m_idleYieldCount == 0)
+    {
+        return false;
+    }
+
+    if (++m_spinningCount > m_spinningLimit)
+    {
+        --m_spinningCount;
+        return false;
+    }
+
+    return true;
+}
+
+bool
+ThreadPool::Park(Worker& rWorker, bool spinning)
+{
+    std::unique_lock<std::mutex> uniqueLock(m_mutex);
+
+    // Register as sleeping before we stop spinning, a notifier that sees no
+    // spinning worker is then guaranteed to see us sleeping
+    ++m_sleepingCount;
+
+    if (spinning)
+    {
+        --m_spinningCount;
+    }
+
+    auto predicate = [this](){
+        return !m_runThreads || m_pendingCount > 0;
+    };
+
+    bool idle = false;
+
+    if (m_elastic)
+    {
+        idle = !m_condition.wait_for(uniqueLock, m_options.m_idleTimeout, predicate);
+    }
+    else
+    {
+        m_condition.wait(uniqueLock, predicate);
+    }
+
+    --m_sleepingCount;
+    uniqueLock.unlock();
+
+    return idle && RetireWorker(rWorker);
+}
+
+//******************************************************************************
+// MARK: Elastic
 //******************************************************************************
 
+bool
+ThreadPool::StartWorker() noexcept
+{
+    std::lock_guard<std::mutex> lockGuard(m_workerMutex);
+
+    if (!m_runThreads)
+    {
+        return false;
+    }
+
+    for (auto& rpWorker : m_workers)
+    {
+        if (rpWorker->m_active)
+        {
+            continue;
+        }
+
+        try
+        {
+            StartThread(*rpWorker);
+            return true;
+        }
+        catch (const std::exception&)
+        {
+            // Adding workers is a hint, running out of threads is not fatal
+            return false;
+        }
+    }
+
+    return false;
+}
+
 void
-ThreadPool::RunThread(ThreadPool* pInstance) noexcept
+ThreadPool::StartThread(Worker& rWorker)
+{
+    // A retired worker thread is done with the worker once it is inactive,
+    // at most the return from the thread function is left
+    if (rWorker.m_thread.joinable())
+    {
+        rWorker.m_thread.join();
+    }
+
+    rWorker.m_active = true;
+    ++m_activeCount;
+
+    try
+    {
+        rWorker.m_thread = std::thread(RunThread, this, &rWorker);
+    }
+    catch (...)
+    {
+        rWorker.m_active = false;
+        --m_activeCount;
+        throw;
+    }
+
+    // Pinning is a placement hint, failing to pin leaves the thread
+    // free to run anywhere which is still correct
+    if (!m_options.m_threadAffinity.empty())
+    {
+        const auto& c_rCpus = m_options.m_threadAffinity[rWorker.m_index % m_options.m_threadAffinity.size()];
+        Topology::SetAffinity(rWorker.m_thread, c_rCpus);
+    }
+    else if (m_nodes.size() > 1)
+    {
+        Topology::SetAffinity(rWorker.m_thread, m_nodes[rWorker.m_nodeIndex]->m_cpus);
+    }
+
+#if defined(__linux__)
+    if (!m_options.m_threadName.empty())
+    {
+        // Linux limits thread names to 15 characters
+        auto name = m_options.m_threadName + std::to_string(rWorker.m_index);
+        pthread_setname_np(rWorker.m_thread.native_handle(), name.substr(0, 15).c_str());
+    }
+#endif
+}
+
+bool
+ThreadPool::RetireWorker(Worker& rWorker) noexcept
 {
-    std::shared_ptr<TaskThread> pTaskThread(nullptr);
+    std::lock_guard<std::mutex> lockGuard(m_workerMutex);
 
-    while (true)
+    // Work which arrived in the meantime is for us to take care of
+    if (!m_runThreads || m_pendingCount > 0 || m_activeCount <= m_options.m_minThreadCount)
     {
+        return false;
+    }
+
+    --m_activeCount;
+    rWorker.m_active = false;
+
+    return true;
+}
+
+void
+ThreadPool::RunMonitor(ThreadPool* pInstance) noexcept
+{
+    std::unique_lock<std::mutex> uniqueLock(pInstance->m_workerMutex);
+
+    size_t dequeuedCount = pInstance->m_dequeuedCount;
+
+    while (pInstance->m_runThreads)
+    {
+        pInstance->m_monitorCondition.wait_for(uniqueLock, pInstance->m_options.m_queueDelay);
+
+        auto currentCount = pInstance->m_dequeuedCount.load();
+
+        // Queued work nobody took for a whole delay means all workers are 
+        // busy, sleeping workers would have been woken for it
+        bool stalled = currentCount == dequeuedCount &&
+                       pInstance->m_pendingCount > 0 &&
+                       pInstance->m_sleepingCount == 0 &&
+                       pInstance->m_spinningCount == 0;
+
+        dequeuedCount = currentCount;
+
+        if (stalled && pInstance->m_runThreads)
         {
-            std::unique_lock<std::mutex> uniqueLock(pInstance->m_mutex);
+            uniqueLock.unlock();
+            pInstance->StartWorker();
+            uniqueLock.lock();
+        }
+    }
+}
 
-            if (pInstance->m_taskThreads.empty())
+//******************************************************************************
+// MARK: Run Thread
+//******************************************************************************
+
+void
+ThreadPool::RunThread(ThreadPool* pInstance, Worker* pWorker) noexcept
+{
+    s_pCurrentThreadPool = pInstance;
+    s_pCurrentWorker = pWorker;
+
+    libcpptask_TRACE_THREAD_NAME("Worker " + std::to_string(pWorker->m_index));
+
+    size_t idleCount = 0;
+    bool spinning = false;
+
+    while (pInstance->m_runThreads)
+    {
+        auto pTaskThread = pInstance->Dequeue(*pWorker);
+
+        if (!pTaskThread)
+        {
+            if (idleCount == 0)
             {
-                pInstance->m_condition.wait(uniqueLock);
+                spinning = pInstance->StartSpinning();
             }
 
-            if (!pInstance->m_runThreads)
+            // Spin with pauses first, then yield, then park
+            if (spinning && idleCount < pInstance->m_idleSpinCount)
             {
-                break;
+                Pause();
+                ++idleCount;
             }
-            else if (pInstance->m_taskThreads.empty())
+            else if (spinning && idleCount < pInstance->m_idleSpinCount + pInstance->m_idleYieldCount)
             {
-                continue;
+                std::this_thread::yield();
+                ++idleCount;
             }
+            else
+            {
+                if (pInstance->Park(*pWorker, spinning))
+                {
+                    spinning = false;
+                    break;
+                }
 
-            pTaskThread.swap(pInstance->m_taskThreads.front());
-            pInstance->m_taskThreads.pop_front();
+                spinning = false;
+                idleCount = 0;
+            }
+
+            continue;
+        }
+
+        // Enqueue skips waking workers while we spin, pass it on if there is
+        // more work than we are about to take care of
+        if (spinning)
+        {
+            spinning = false;
+            --pInstance->m_spinningCount;
+
+            if (pInstance->m_pendingCount > 0)
+            {
+                pInstance->Notify();
+            }
         }
 
+        idleCount = 0;
+
+        libcpptask_TRACE(TraceEventType::DEQUEUE, pTaskThread.get());
+
+        auto& rMetrics = pWorker->m_metrics;
+        auto startTime = std::chrono::steady_clock::now();
+
+        rMetrics.m_busy.store(true, std::memory_order_relaxed);
+        Add<size_t>(rMetrics.m_queueWaitBuckets[GetBucket(startTime - pTaskThread->m_enqueueTime)], 1);
+
+        // Runs which threw never started and count as nothing
+        auto state = TaskState::WAITING;
+
         try
         {
-            pTaskThread->Run();
+            state = pTaskThread->Run();
         }
         catch (const std::exception& e)
         {
 #if defined(DEBUG) || defined(_DEBUG)
-            std::stderr << e.what();
+            std::cerr << e.what();
 #endif
         }
+
+        auto runTime = std::chrono::steady_clock::now() - startTime;
+
+        Add<size_t>(rMetrics.m_runTimeBuckets[GetBucket(runTime)], 1);
+        Add<std::int64_t>(rMetrics.m_busyTime, std::chrono::duration_cast<std::chrono::nanoseconds>(runTime).count());
+
+        // A suspended coroutine is neither, every resume counts as a run of
+        // its own
+        switch (state)
+        {
+            case TaskState::FINISHED:
+                Add<size_t>(rMetrics.m_completedCount, 1);
+                break;
+            case TaskState::FAULTED:
+                Add<size_t>(rMetrics.m_failedCount, 1);
+                break;
+            case TaskState::CANCELLED:
+                Add<size_t>(rMetrics.m_cancelledCount, 1);
+                break;
+            default:
+                break;
+        }
+
+        rMetrics.m_busy.store(false, std::memory_order_relaxed);
+    }
+
+    if (spinning)
+    {
+        --pInstance->m_spinningCount;
     }
+
+    s_pCurrentThreadPool = nullptr;
+    s_pCurrentWorker = nullptr;
 }
 
 // Namespace
@@ -19,23 +19,75 @@
 #define libcpptask_CppTask_ThreadPool_h
 
 // STL
-#include <list>
+#include <array>
+#include <chrono>
+#include <deque>
+#include <vector>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
+#include <atomic>
+#include <cstdint>
+#include <memory>
 
 // External
 
 // Project
 #include "../include/libcpptask/CppTask_Task.h"
+#include "../include/libcpptask/CppTask_Pool.h"
+#include "./CppTask_BoundedQueue.h"
+#include "./CppTask_Topology.h"
 
 
 // Namespace
 namespace CppTask {
 
+// Forward declarations
+class ThreadPool;
+
+//******************************************************************************
+// MARK: Timer Target
+//******************************************************************************
+
+/**
+ *  @brief The timer target lets timers reach a thread pool which may be 
+ *         destroyed before they fire. The thread pool clears itself from the
+ *         target under the mutex when destroyed, timers hold the mutex while
+ *         enqueuing.
+ */
+struct TimerTarget
+{
+    std::mutex m_mutex;
+    ThreadPool* m_pThreadPool;
+};
+
+//******************************************************************************
+// MARK: Thread Pool
+//******************************************************************************
+
 /**
- *  @brief The thread pool singleton is responsible for running individual
- *         task thread instances.
+ *  @brief The thread pool is responsible for running individual task thread
+ *         instances. The singleton is the default pool, further pools are
+ *         created through the public pool class.
+ *
+ *         Every worker thread owns a local deque. Task threads enqueued from
+ *         a worker thread are pushed to the local deque of that worker, task
+ *         threads enqueued from any other thread are pushed to the lock-free
+ *         injection queue of a node. Idle workers take work from their local 
+ *         deque first, then from the injection queues starting with their own
+ *         node and finally steal from the other workers, again starting with
+ *         their own node.
+ *
+ *         Pools which are not NUMA aware use a single node for all workers.
+ *
+ *         Every deque and injection queue exists once per task priority. 
+ *         Workers check the highest priority first, but periodically start
+ *         with one of the lower priorities so those are never starved.
+ *
+ *         Elastic pools create the workers for the maximum thread count up 
+ *         front, but only run threads for some of them. A monitor thread 
+ *         starts further workers while queued work makes no progress, idle 
+ *         workers retire after a timeout.
  */
 class ThreadPool
 {
@@ -51,6 +103,18 @@ public:
      *  @param c_rThreadPool ThreadPool class source.
      */
     ThreadPool(const ThreadPool& c_rThreadPool) = delete;
+
+    /**
+     *  @brief Options constructor.
+     *
+     *  @param c_rOptions The pool options.
+     */
+    explicit ThreadPool(const PoolOptions& c_rOptions);
+
+    /**
+     *  @brief Default destructor.
+     */
+    virtual ~ThreadPool() noexcept;
     
     //**************************************************************************
     // MARK: Singleton
@@ -63,6 +127,36 @@ public:
      */
     static ThreadPool&
     Singleton();
+
+    /**
+     *  @brief Get the thread pool of the calling thread if it is a pool 
+     *         thread, or the singleton otherwise. This function is 
+     *         thread-safe.
+     *
+     *  @returns The thread pool instance.
+     */
+    static ThreadPool&
+    Current();
+
+    /**
+     *  @brief Get the thread pool of the calling thread. This function is
+     *         thread-safe.
+     *
+     *  @returns The thread pool instance, or nullptr if the calling thread is
+     *           not a pool thread.
+     */
+    static ThreadPool*
+    CurrentWorkerPool() noexcept;
+
+    /**
+     *  @brief Get the index of the calling thread among the workers of its
+     *         thread pool. This function is thread-safe.
+     *
+     *  @returns The worker index, or Pool::s_noWorkerIndex if the calling 
+     *           thread is not a pool thread.
+     */
+    static size_t
+    CurrentWorkerIndex() noexcept;
     
     //**************************************************************************
     // MARK: Enqueue
@@ -73,25 +167,282 @@ public:
      *         is thread-safe.
      *
      *  @param pTaskThread The task thread to run.
+     *  @param priority The priority to run the task thread with.
+     */
+    void
+    Enqueue(IntrusivePointer<TaskThread> pTaskThread, TaskPriority priority = TaskPriority::NORMAL);
+
+    /**
+     *  @brief Enqueue task threads to be run on the thread pool as a single
+     *         batch. The pending work is published and workers are woken 
+     *         once for the whole batch. This function is thread-safe.
+     *
+     *  @param rTaskThreads The task threads to run. Moved from.
+     *  @param c_rPriorities The priority of every task thread.
      */
     void
-    Enqueue(std::shared_ptr<TaskThread> pTaskThread);
+    EnqueueAll(std::vector<IntrusivePointer<TaskThread>>& rTaskThreads, 
+               const std::vector<TaskPriority>& c_rPriorities);
+
+    //**************************************************************************
+    // MARK: Getters
+    //**************************************************************************
+
+    /**
+     *  @brief Get the number of running pool threads. This function is 
+     *         thread-safe.
+     *
+     *  @returns The number of pool threads.
+     */
+    size_t
+    GetThreadCount() const noexcept;
+
+    /**
+     *  @brief Check if the thread pool has enough queued work for task 
+     *         threads to run on the enqueuing thread instead. This function is
+     *         thread-safe.
+     *
+     *  @returns True if the thread pool is saturated, false if not.
+     */
+    bool
+    IsSaturated() const noexcept;
+
+    /**
+     *  @brief Get a snapshot of the thread pool activity. This function is 
+     *         thread-safe.
+     *
+     *  @returns The thread pool metrics.
+     */
+    PoolMetrics
+    GetMetrics() const;
+
+    /**
+     *  @brief Get the target for timers enqueuing onto the thread pool. The
+     *         target outlives the thread pool. This function is thread-safe.
+     *
+     *  @returns The timer target.
+     */
+    const std::shared_ptr<TimerTarget>&
+    GetTimerTarget() const noexcept
+    {
+        return m_pTimerTarget;
+    }
+
+    //**************************************************************************
+    // MARK: Blocking
+    //**************************************************************************
+
+    /**
+     *  @brief Mark the calling pool thread as blocked. Elastic pools start
+     *         another worker if not enough unblocked workers are left. This
+     *         function is thread-safe.
+     */
+    void
+    BeginBlocking() noexcept;
+
+    /**
+     *  @brief Mark the calling pool thread as no longer blocked. This 
+     *         function is thread-safe.
+     */
+    void
+    EndBlocking() noexcept;
 
 private:
 
     //**************************************************************************
-    // MARK: Constructor / Destructor
+    // MARK: Lanes
     //**************************************************************************
-    
+
+    static constexpr size_t s_laneCount = TaskPriority::HIGH + 1;
+
+    using Lane = BoundedQueue<IntrusivePointer<TaskThread>>;
+
+    //**************************************************************************
+    // MARK: Worker
+    //**************************************************************************
+
     /**
-     *  @brief Default constructor.
+     *  @brief The activity counters of a worker. Only the worker thread writes
+     *         them, relaxed and without read-modify-write operations; the 
+     *         metrics snapshot sums them up.
      */
-    ThreadPool();
+    struct WorkerMetrics
+    {
+        std::atomic<size_t> m_completedCount { 0 };
+        std::atomic<size_t> m_failedCount { 0 };
+        std::atomic<size_t> m_cancelledCount { 0 };
+        std::atomic<std::int64_t> m_busyTime { 0 };
+        std::atomic<bool> m_busy { false };
+        
+        std::array<std::atomic<size_t>, LatencyHistogram::s_bucketCount> m_queueWaitBuckets {};
+        std::array<std::atomic<size_t>, LatencyHistogram::s_bucketCount> m_runTimeBuckets {};
+    };
 
     /**
-     *  @brief Default destructor.
+     *  @brief The worker holds the local task thread deque of a single pool
+     *         thread. The owning thread pushes and pops at the back, other
+     *         threads steal from the front. There is a deque per priority.
      */
-    virtual ~ThreadPool() noexcept;
+    struct Worker
+    {
+        std::mutex m_mutex;
+        std::array<std::deque<IntrusivePointer<TaskThread>>, s_laneCount> m_taskThreads;
+        size_t m_index;
+        size_t m_nodeIndex;
+        size_t m_dequeueCount = 0;
+
+        std::thread m_thread;
+        std::atomic<bool> m_active { false };
+
+        WorkerMetrics m_metrics;
+    };
+
+    //**************************************************************************
+    // MARK: Node
+    //**************************************************************************
+
+    /**
+     *  @brief The node holds the injection queue shared by the workers placed
+     *         on a single NUMA node. There is a queue per priority.
+     */
+    struct Node
+    {
+        explicit Node(size_t capacity)
+        {
+            for (auto& rpLane : m_taskThreads)
+            {
+                rpLane = std::make_unique<Lane>(capacity);
+            }
+        }
+
+        std::array<std::unique_ptr<Lane>, s_laneCount> m_taskThreads;
+        std::vector<size_t> m_cpus;
+    };
+
+    //**************************************************************************
+    // MARK: Inject
+    //**************************************************************************
+
+    /**
+     *  @brief Push a task thread to the injection queue of the calling node.
+     *         If all queues are full the configured full queue policy is 
+     *         applied. This function is thread-safe.
+     *
+     *  @param rTaskThread The task thread to push. Moved from on success.
+     *  @param lane The priority lane to push to.
+     */
+    void
+    Inject(IntrusivePointer<TaskThread>& rTaskThread, size_t lane);
+
+    /**
+     *  @brief Get the node of the CPU the calling thread runs on.
+     *
+     *  @returns The node index.
+     */
+    size_t
+    GetCurrentNode() const noexcept;
+
+    //**************************************************************************
+    // MARK: Dequeue
+    //**************************************************************************
+
+    /**
+     *  @brief Take the next task thread to run for a worker. The local deque
+     *         is checked first, then the injection queues, then the other 
+     *         workers.
+     *
+     *  @param rWorker The worker to dequeue for.
+     *
+     *  @returns The task thread to run, or nullptr if none was found.
+     */
+    IntrusivePointer<TaskThread>
+    Dequeue(Worker& rWorker);
+
+    /**
+     *  @brief Take the next task thread of a single priority lane.
+     *
+     *  @param rWorker The worker to dequeue for.
+     *  @param lane The priority lane to dequeue from.
+     *
+     *  @returns The task thread to run, or nullptr if none was found.
+     */
+    IntrusivePointer<TaskThread>
+    DequeueLane(Worker& rWorker, size_t lane);
+
+    /**
+     *  @brief Wake sleeping workers for new work, unless spinning workers
+     *         take care of it. This function is thread-safe.
+     *
+     *  @param count The number of new task threads.
+     */
+    void
+    Notify(size_t count = 1);
+
+    //**************************************************************************
+    // MARK: Idle
+    //**************************************************************************
+
+    /**
+     *  @brief Register the calling worker as spinning, unless enough workers
+     *         already spin. This function is thread-safe.
+     *
+     *  @returns True if the worker spins, false if it should park.
+     */
+    bool
+    StartSpinning() noexcept;
+
+    /**
+     *  @brief Park the calling worker until work is pending or the thread 
+     *         pool stops. Workers of elastic pools retire if they stay idle
+     *         for too long. This function is thread-safe.
+     *
+     *  @param rWorker The worker to park.
+     *  @param spinning True if the worker was registered as spinning.
+     *
+     *  @returns True if the worker retired, false if not.
+     */
+    bool
+    Park(Worker& rWorker, bool spinning);
+
+    //**************************************************************************
+    // MARK: Elastic
+    //**************************************************************************
+
+    /**
+     *  @brief Start the thread of an inactive worker if the thread count 
+     *         limit allows it. This function is thread-safe.
+     *
+     *  @returns True if a thread was started, false if not.
+     */
+    bool
+    StartWorker() noexcept;
+
+    /**
+     *  @brief Start the thread of a worker. The worker mutex has to be held.
+     *
+     *  @param rWorker The worker to start the thread for.
+     */
+    void
+    StartThread(Worker& rWorker);
+
+    /**
+     *  @brief Retire the calling idle worker if the minimum thread count
+     *         allows it. This function is thread-safe.
+     *
+     *  @param rWorker The worker to retire.
+     *
+     *  @returns True if the worker retired, false if not.
+     */
+    bool
+    RetireWorker(Worker& rWorker) noexcept;
+
+    /**
+     *  @brief Start workers while queued work makes no progress.
+     * 
+     *  @param pInstance The class instance to monitor.
+     */
+    static void
+    RunMonitor(ThreadPool* pInstance) noexcept;
 
     //**************************************************************************
     // MARK: Run Thread
@@ -101,24 +452,53 @@ private:
      *  @brief Run a task thread.
      * 
      *  @param pInstance The class instance to update with.
+     *  @param pWorker The worker owned by the thread.
      */
     static void
-    RunThread(ThreadPool* pInstance) noexcept;
+    RunThread(ThreadPool* pInstance, Worker* pWorker) noexcept;
 
     //**************************************************************************
     // MARK: Variables
     //**************************************************************************
     
-    std::list<std::thread> m_threads;
+    PoolOptions m_options;
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::vector<std::unique_ptr<Node>> m_nodes;
+    std::vector<size_t> m_cpuNodes;
     std::mutex m_mutex;
     std::condition_variable m_condition;
+    std::condition_variable m_spaceCondition;
+
+    std::atomic<bool> m_runThreads;
+    std::atomic<size_t> m_pendingCount;
+    std::atomic<size_t> m_sleepingCount;
+    std::atomic<size_t> m_blockedCount;
+    std::atomic<size_t> m_spinningCount;
+
+    size_t m_idleSpinCount;
+    size_t m_idleYieldCount;
+    size_t m_spinningLimit;
+    size_t m_inlineThreshold;
+
+    bool m_elastic;
+    size_t m_targetCount;
+    std::mutex m_workerMutex;
+    std::condition_variable m_monitorCondition;
+    std::thread m_monitorThread;
+    std::atomic<size_t> m_activeCount;
+    std::atomic<size_t> m_blockingCount;
+    std::atomic<size_t> m_dequeuedCount;
+    std::array<std::atomic<size_t>, s_laneCount> m_lanePendingCounts;
+    std::atomic<size_t> m_submittedCount;
 
-    bool m_runThreads;
+    std::shared_ptr<TimerTarget> m_pTimerTarget;
 
-    std::list<std::shared_ptr<TaskThread>> m_taskThreads;
+    static thread_local ThreadPool* s_pCurrentThreadPool;
+    static thread_local Worker* s_pCurrentWorker;
 };
 
 // Namespace
 }
 
-#endif /* libcpptask_CppTask_ThreadPool_h */
\ No newline at end of file
+#endif /* libcpptask_CppTask_ThreadPool_h */
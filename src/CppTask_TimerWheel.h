@@ -0,0 +1,434 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef libcpptask_CppTask_TimerWheel_h
+#define libcpptask_CppTask_TimerWheel_h
+
+// STL
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// External
+
+// Project
+
+
+// Namespace
+namespace CppTask {
+
+//******************************************************************************
+// MARK: Timer Node
+//******************************************************************************
+
+/**
+ *  @brief The timer node is the intrusive link of a timer in a timer wheel,
+ *         the wheel never allocates.
+ */
+struct TimerNode
+{
+    TimerNode* m_pPrevious = nullptr;
+    TimerNode* m_pNext = nullptr;
+    TimerNode** m_ppSlot = nullptr;
+    std::uint64_t m_tick = 0;
+
+    /**
+     *  @brief Check if the node is linked into a wheel.
+     *
+     *  @returns True if linked, false if not.
+     */
+    bool
+    IsLinked() const noexcept
+    {
+        return m_ppSlot != nullptr;
+    }
+};
+
+//******************************************************************************
+// MARK: Timer Wheel
+//******************************************************************************
+
+/**
+ *  @brief The timer wheel is a hierarchical timing wheel. Every level has a
+ *         slot per tick of the level below, a node is linked into the slot 
+ *         of the lowest level its distance fits into. Whenever a level 
+ *         completes a rotation the current slot of the next level is 
+ *         cascaded down and redistributed. Inserting and removing is 
+ *         constant time, advancing is constant time per tick plus the 
+ *         expired and cascaded nodes.
+ *
+ *         The four levels of 256 slots cover 2^32 ticks, nodes further away
+ *         are parked in the last slot they fit into until they come closer.
+ *         The wheel is not thread-safe.
+ */
+class TimerWheel
+{
+public:
+
+    static constexpr size_t s_levelBits = 8;
+    static constexpr size_t s_levelCount = 4;
+    static constexpr size_t s_slotCount = size_t(1) << s_levelBits;
+
+    //**************************************************************************
+    // MARK: Constructor
+    //**************************************************************************
+
+    /**
+     *  @brief Default constructor. The wheel starts at tick 0.
+     */
+    TimerWheel() noexcept
+    : m_slots(),
+      m_nextTick(0),
+      m_count(0)
+    {}
+
+    /**
+     *  @brief Copy constructor. Disabled for this class.
+     *
+     *  @param c_rTimerWheel TimerWheel class source.
+     */
+    TimerWheel(const TimerWheel& c_rTimerWheel) = delete;
+
+    //**************************************************************************
+    // MARK: Insert / Remove
+    //**************************************************************************
+
+    /**
+     *  @brief Insert a node which is not linked. Nodes for ticks already 
+     *         passed expire with the next advance.
+     *
+     *  @param pNode The node to insert.
+     *  @param tick The tick to expire at.
+     */
+    void
+    Insert(TimerNode* pNode, std::uint64_t tick) noexcept
+    {
+        pNode->m_tick = tick;
+        Link(pNode);
+        ++m_count;
+    }
+
+    /**
+     *  @brief Remove a node.
+     *
+     *  @param pNode The node to remove.
+     *
+     *  @returns True if the node was linked, false if not.
+     */
+    bool
+    Remove(TimerNode* pNode) noexcept
+    {
+        if (!pNode->IsLinked())
+        {
+            return false;
+        }
+
+        Unlink(pNode);
+        --m_count;
+
+        return true;
+    }
+
+    /**
+     *  @brief Remove all nodes. The remove function is called with every node
+     *         once it was unlinked.
+     *
+     *  @param rRemove The function to call with every removed node.
+     */
+    template <typename F>
+    void
+    Clear(F&& rRemove)
+    {
+        for (auto& rLevel : m_slots)
+        {
+            for (auto& rpHead : rLevel)
+            {
+                auto pNode = Detach(rpHead);
+
+                while (pNode)
+                {
+                    auto pNext = pNode->m_pNext;
+                    pNode->m_pNext = nullptr;
+
+                    rRemove(pNode);
+                    pNode = pNext;
+                }
+            }
+        }
+
+        m_count = 0;
+    }
+
+    //**************************************************************************
+    // MARK: Advance
+    //**************************************************************************
+
+    /**
+     *  @brief Advance the wheel through a tick and expire all nodes due by 
+     *         then. Expired nodes are unlinked before the expire function is
+     *         called with them, it may insert nodes again.
+     *
+     *  @param tick The tick to advance through.
+     *  @param rExpire The function to call with every expired node.
+     */
+    template <typename F>
+    void
+    Advance(std::uint64_t tick, F&& rExpire)
+    {
+        while (m_nextTick <= tick)
+        {
+            // Nothing can expire, skip right to the end
+            if (m_count == 0)
+            {
+                m_nextTick = tick + 1;
+                break;
+            }
+
+            // A completed rotation brings the next slot of the level above 
+            // down, which may complete a rotation of that level as well
+            for (size_t level = 1; level < s_levelCount; ++level)
+            {
+                if (GetSlotIndex(m_nextTick, level - 1) != 0)
+                {
+                    break;
+                }
+
+                Cascade(m_slots[level][GetSlotIndex(m_nextTick, level)]);
+            }
+
+            auto pNode = Detach(m_slots[0][GetSlotIndex(m_nextTick, 0)]);
+            ++m_nextTick;
+
+            while (pNode)
+            {
+                auto pNext = pNode->m_pNext;
+                pNode->m_pNext = nullptr;
+
+                // Parked nodes further away than the wheel covers go back
+                if (pNode->m_tick < m_nextTick)
+                {
+                    --m_count;
+                    rExpire(pNode);
+                }
+                else
+                {
+                    Link(pNode);
+                }
+
+                pNode = pNext;
+            }
+        }
+    }
+
+    //**************************************************************************
+    // MARK: Getters
+    //**************************************************************************
+
+    /**
+     *  @brief Get the next tick the wheel has to be advanced through. Nothing
+     *         expires before, but nothing might expire at the tick either if 
+     *         only cascading is due.
+     *
+     *  @param rTick The next tick.
+     *
+     *  @returns True if a node is linked, false if the wheel is empty.
+     */
+    bool
+    GetNextTick(std::uint64_t& rTick) const noexcept
+    {
+        if (m_count == 0)
+        {
+            return false;
+        }
+
+        auto index = GetSlotIndex(m_nextTick, 0);
+
+        // A pending cascade may bring down nodes for any slot
+        if (index != 0)
+        {
+            for (; index < s_slotCount; ++index)
+            {
+                if (m_slots[0][index])
+                {
+                    rTick = (m_nextTick & ~std::uint64_t(s_slotCount - 1)) + index;
+                    return true;
+                }
+            }
+        }
+
+        rTick = (m_nextTick + s_slotCount - 1) & ~std::uint64_t(s_slotCount - 1);
+        return true;
+    }
+
+    /**
+     *  @brief Get the next tick to be advanced through.
+     *
+     *  @returns The tick.
+     */
+    std::uint64_t
+    GetCurrentTick() const noexcept
+    {
+        return m_nextTick;
+    }
+
+    /**
+     *  @brief Get the number of linked nodes.
+     *
+     *  @returns The node count.
+     */
+    size_t
+    GetCount() const noexcept
+    {
+        return m_count;
+    }
+
+private:
+
+    //**************************************************************************
+    // MARK: Slots
+    //**************************************************************************
+
+    /**
+     *  @brief Get the slot index of a tick on a level.
+     *
+     *  @param tick The tick.
+     *  @param level The level.
+     *
+     *  @returns The slot index.
+     */
+    static size_t
+    GetSlotIndex(std::uint64_t tick, size_t level) noexcept
+    {
+        return static_cast<size_t>(tick >> (level * s_levelBits)) & (s_slotCount - 1);
+    }
+
+    /**
+     *  @brief Link a node into the slot its distance from the next tick falls
+     *         into.
+     *
+     *  @param pNode The node to link.
+     */
+    void
+    Link(TimerNode* pNode) noexcept
+    {
+        constexpr std::uint64_t c_maxDistance = (std::uint64_t(1) << (s_levelCount * s_levelBits)) - 1;
+
+        auto distance = pNode->m_tick > m_nextTick ? pNode->m_tick - m_nextTick : 0;
+        distance = distance < c_maxDistance ? distance : c_maxDistance;
+
+        size_t level = 0;
+
+        while (level + 1 < s_levelCount && distance >= (std::uint64_t(1) << ((level + 1) * s_levelBits)))
+        {
+            ++level;
+        }
+
+        auto& rpHead = m_slots[level][GetSlotIndex(m_nextTick + distance, level)];
+
+        pNode->m_pPrevious = nullptr;
+        pNode->m_pNext = rpHead;
+        pNode->m_ppSlot = &rpHead;
+
+        if (rpHead)
+        {
+            rpHead->m_pPrevious = pNode;
+        }
+
+        rpHead = pNode;
+    }
+
+    /**
+     *  @brief Unlink a node from its slot.
+     *
+     *  @param pNode The node to unlink.
+     */
+    static void
+    Unlink(TimerNode* pNode) noexcept
+    {
+        if (pNode->m_pPrevious)
+        {
+            pNode->m_pPrevious->m_pNext = pNode->m_pNext;
+        }
+        else
+        {
+            *pNode->m_ppSlot = pNode->m_pNext;
+        }
+
+        if (pNode->m_pNext)
+        {
+            pNode->m_pNext->m_pPrevious = pNode->m_pPrevious;
+        }
+
+        pNode->m_pPrevious = nullptr;
+        pNode->m_pNext = nullptr;
+        pNode->m_ppSlot = nullptr;
+    }
+
+    /**
+     *  @brief Take all nodes of a slot. The nodes stay chained through their
+     *         next pointers, but are no longer linked.
+     *
+     *  @param rpHead The slot.
+     *
+     *  @returns The first node of the slot.
+     */
+    static TimerNode*
+    Detach(TimerNode*& rpHead) noexcept
+    {
+        auto pFirst = rpHead;
+        rpHead = nullptr;
+
+        for (auto pNode = pFirst; pNode; pNode = pNode->m_pNext)
+        {
+            pNode->m_pPrevious = nullptr;
+            pNode->m_ppSlot = nullptr;
+        }
+
+        return pFirst;
+    }
+
+    /**
+     *  @brief Redistribute the nodes of a slot onto the lower levels.
+     *
+     *  @param rpHead The slot.
+     */
+    void
+    Cascade(TimerNode*& rpHead) noexcept
+    {
+        auto pNode = Detach(rpHead);
+
+        while (pNode)
+        {
+            auto pNext = pNode->m_pNext;
+            Link(pNode);
+            pNode = pNext;
+        }
+    }
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    std::array<std::array<TimerNode*, s_slotCount>, s_levelCount> m_slots;
+    std::uint64_t m_nextTick;
+    size_t m_count;
+};
+
+// Namespace
+}
+
+#endif /* libcpptask_CppTask_TimerWheel_h */
@@ -0,0 +1,169 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// STL
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+#if defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+// External
+
+// Project
+#include "./CppTask_Topology.h"
+
+
+// Namespace
+namespace CppTask {
+
+//******************************************************************************
+// MARK: Nodes
+//******************************************************************************
+
+std::vector<std::vector<size_t>>
+Topology::GetNodeCpus()
+{
+    std::vector<std::vector<size_t>> nodes;
+
+#if defined(__linux__)
+    // Nodes are numbered without gaps in practice, stop at the first missing
+    for (size_t i = 0; ; ++i)
+    {
+        std::ifstream file("/sys/devices/system/node/node" + std::to_string(i) + "/cpulist");
+
+        if (!file.is_open())
+        {
+            break;
+        }
+
+        std::string cpuList;
+        std::getline(file, cpuList);
+
+        auto cpus = ParseCpuList(cpuList);
+
+        // Memory only nodes have no CPUs to run workers on
+        if (!cpus.empty())
+        {
+            nodes.emplace_back(std::move(cpus));
+        }
+    }
+#endif
+
+    if (nodes.empty())
+    {
+        auto cpuCount = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+
+        nodes.emplace_back();
+
+        for (size_t i = 0; i < cpuCount; ++i)
+        {
+            nodes.back().emplace_back(i);
+        }
+    }
+
+    return nodes;
+}
+
+int
+Topology::GetCurrentCpu() noexcept
+{
+#if defined(__linux__)
+    return sched_getcpu();
+#else
+    return -1;
+#endif
+}
+
+//******************************************************************************
+// MARK: Affinity
+//******************************************************************************
+
+bool
+Topology::SetAffinity(std::thread& rThread, const std::vector<size_t>& c_rCpus) noexcept
+{
+#if defined(__linux__)
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+
+    bool hasCpu = false;
+
+    for (auto cpu : c_rCpus)
+    {
+        if (cpu < CPU_SETSIZE)
+        {
+            CPU_SET(cpu, &cpuSet);
+            hasCpu = true;
+        }
+    }
+
+    if (!hasCpu)
+    {
+        return false;
+    }
+
+    return pthread_setaffinity_np(rThread.native_handle(), sizeof(cpuSet), &cpuSet) == 0;
+#else
+    return false;
+#endif
+}
+
+//******************************************************************************
+// MARK: Parse
+//******************************************************************************
+
+std::vector<size_t>
+Topology::ParseCpuList(const std::string& c_rCpuList)
+{
+    std::vector<size_t> cpus;
+    std::stringstream stream(c_rCpuList);
+    std::string entry;
+
+    while (std::getline(stream, entry, ','))
+    {
+        try
+        {
+            auto separator = entry.find('-');
+
+            if (separator == std::string::npos)
+            {
+                cpus.emplace_back(std::stoul(entry));
+                continue;
+            }
+
+            auto first = std::stoul(entry.substr(0, separator));
+            auto last = std::stoul(entry.substr(separator + 1));
+
+            for (auto cpu = first; cpu <= last; ++cpu)
+            {
+                cpus.emplace_back(cpu);
+            }
+        }
+        catch (const std::exception&)
+        {
+            // Skip malformed entries, we still want the valid ones
+        }
+    }
+
+    return cpus;
+}
+
+// Namespace
+}
@@ -0,0 +1,99 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef libcpptask_CppTask_Topology_h
+#define libcpptask_CppTask_Topology_h
+
+// STL
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstddef>
+
+// External
+
+// Project
+
+
+// Namespace
+namespace CppTask {
+
+/**
+ *  @brief The topology class provides the CPU and NUMA node layout of the 
+ *         machine, and the means to pin threads to CPUs. Only Linux is
+ *         supported; other platforms report a single node and ignore pinning.
+ */
+class Topology
+{
+public:
+
+    //**************************************************************************
+    // MARK: Nodes
+    //**************************************************************************
+
+    /**
+     *  @brief Get the CPUs of every NUMA node. Machines without NUMA 
+     *         information report a single node with all CPUs.
+     *
+     *  @returns The CPU list of every node.
+     */
+    static std::vector<std::vector<size_t>>
+    GetNodeCpus();
+
+    /**
+     *  @brief Get the CPU the calling thread currently runs on.
+     *
+     *  @returns The CPU index, or -1 if unknown.
+     */
+    static int
+    GetCurrentCpu() noexcept;
+
+    //**************************************************************************
+    // MARK: Affinity
+    //**************************************************************************
+
+    /**
+     *  @brief Pin a thread to a set of CPUs. CPUs which do not exist are
+     *         ignored.
+     *
+     *  @param rThread The thread to pin.
+     *  @param c_rCpus The CPUs to allow the thread to run on.
+     *
+     *  @returns True if the thread was pinned, false if not.
+     */
+    static bool
+    SetAffinity(std::thread& rThread, const std::vector<size_t>& c_rCpus) noexcept;
+
+    //**************************************************************************
+    // MARK: Parse
+    //**************************************************************************
+
+    /**
+     *  @brief Parse a kernel CPU list like "0-3,8,10-11".
+     *
+     *  @param c_rCpuList The CPU list to parse.
+     *
+     *  @returns The parsed CPUs. Invalid entries are skipped.
+     */
+    static std::vector<size_t>
+    ParseCpuList(const std::string& c_rCpuList);
+};
+
+// Namespace
+}
+
+#endif /* libcpptask_CppTask_Topology_h */
@@ -0,0 +1,352 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// STL
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// External
+
+// Project
+#include "../include/libcpptask/CppTask_Trace.h"
+#include "../include/libcpptask/CppTask_Exception.h"
+#include "./CppTask_Tracer.h"
+
+
+#ifndef libcpptask_TRACE_BUFFER_CAPACITY
+    #define libcpptask_TRACE_BUFFER_CAPACITY 16384
+#endif
+
+#if libcpptask_TRACE_BUFFER_CAPACITY < (2) || \
+    (libcpptask_TRACE_BUFFER_CAPACITY & (libcpptask_TRACE_BUFFER_CAPACITY - 1)) != (0)
+    #error "Invalid trace buffer capacity, has to be a power of two!"
+#endif
+
+
+// Namespace
+namespace CppTask {
+
+#ifdef libcpptask_TRACING
+
+//******************************************************************************
+// MARK: Trace Buffer
+//******************************************************************************
+
+/**
+ *  @brief A recorded scheduler event.
+ */
+struct TraceEvent
+{
+    std::int64_t m_timestamp;
+    const void* c_pTask;
+    const std::string* c_pName;
+    TraceEventType m_type;
+};
+
+/**
+ *  @brief The ring buffer of a single thread. Only the owning thread writes,
+ *         the event count publishes the written events to the exporter.
+ */
+struct TraceBuffer
+{
+    std::vector<TraceEvent> m_events;
+    std::atomic<size_t> m_count;
+    size_t m_threadIndex;
+    std::string m_threadName;
+};
+
+// Buffers outlive their threads, finished threads still show up in the trace
+static std::mutex s_bufferMutex;
+static std::vector<std::shared_ptr<TraceBuffer>> s_buffers;
+
+static std::atomic<bool> s_recording(false);
+static std::atomic<std::int64_t> s_startTime(0);
+
+/**
+ *  @brief Get the current trace timestamp.
+ *
+ *  @returns The timestamp in nanoseconds.
+ */
+static std::int64_t
+GetTimestamp() noexcept
+{
+    auto duration = std::chrono::steady_clock::now().time_since_epoch();
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+}
+
+/**
+ *  @brief Get the ring buffer of the calling thread, registering it on first
+ *         use.
+ *
+ *  @returns The ring buffer.
+ */
+static TraceBuffer&
+GetBuffer()
+{
+    thread_local std::shared_ptr<TraceBuffer> pBuffer;
+
+    if (!pBuffer)
+    {
+        auto pNewBuffer = std::make_shared<TraceBuffer>();
+        pNewBuffer->m_events.resize(libcpptask_TRACE_BUFFER_CAPACITY);
+        pNewBuffer->m_count = 0;
+
+        std::lock_guard<std::mutex> lockGuard(s_bufferMutex);
+
+        pNewBuffer->m_threadIndex = s_buffers.size();
+        pNewBuffer->m_threadName = "Thread " + std::to_string(s_buffers.size());
+        s_buffers.emplace_back(pNewBuffer);
+        pBuffer = std::move(pNewBuffer);
+    }
+
+    return *pBuffer;
+}
+
+/**
+ *  @brief Write a string as JSON string literal.
+ *
+ *  @param rStream The stream to write to.
+ *  @param c_rString The string to write.
+ */
+static void
+WriteJsonString(std::ostream& rStream, const std::string& c_rString)
+{
+    rStream << '"';
+
+    for (char character : c_rString)
+    {
+        switch (character)
+        {
+            case '"':
+                rStream << "\\\"";
+                break;
+            case '\\':
+                rStream << "\\\\";
+                break;
+            case '\n':
+                rStream << "\\n";
+                break;
+            case '\t':
+                rStream << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(character) < 0x20)
+                {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", character);
+                    rStream << escaped;
+                }
+                else
+                {
+                    rStream << character;
+                }
+                break;
+        }
+    }
+
+    rStream << '"';
+}
+
+//******************************************************************************
+// MARK: Tracer
+//******************************************************************************
+
+void
+Tracer::Record(TraceEventType type, const TaskThread* c_pTaskThread) noexcept
+{
+    if (!s_recording.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    try
+    {
+        auto& rBuffer = GetBuffer();
+        auto count = rBuffer.m_count.load(std::memory_order_relaxed);
+
+        rBuffer.m_events[count & (libcpptask_TRACE_BUFFER_CAPACITY - 1)] = { 
+            GetTimestamp(), 
+            c_pTaskThread,
+            c_pTaskThread->m_pName.load(std::memory_order_relaxed),
+            type 
+        };
+
+        rBuffer.m_count.store(count + 1, std::memory_order_release);
+    }
+    catch (...)
+    {
+        // Tracing must never break scheduling, drop the event
+    }
+}
+
+void
+Tracer::SetThreadName(const std::string& c_rName) noexcept
+{
+    try
+    {
+        auto& rBuffer = GetBuffer();
+
+        std::lock_guard<std::mutex> lockGuard(s_bufferMutex);
+        rBuffer.m_threadName = c_rName;
+    }
+    catch (...)
+    {}
+}
+
+#endif
+
+//******************************************************************************
+// MARK: Recording
+//******************************************************************************
+
+bool
+Trace::IsAvailable() noexcept
+{
+#ifdef libcpptask_TRACING
+    return true;
+#else
+    return false;
+#endif
+}
+
+void
+Trace::Start()
+{
+#ifdef libcpptask_TRACING
+    std::lock_guard<std::mutex> lockGuard(s_bufferMutex);
+
+    for (auto& rBuffer : s_buffers)
+    {
+        rBuffer->m_count.store(0, std::memory_order_relaxed);
+    }
+
+    s_startTime = GetTimestamp();
+    s_recording = true;
+#else
+    throw Exception("Tracing is not available in this build!");
+#endif
+}
+
+void
+Trace::Stop() noexcept
+{
+#ifdef libcpptask_TRACING
+    s_recording = false;
+#endif
+}
+
+bool
+Trace::IsRecording() noexcept
+{
+#ifdef libcpptask_TRACING
+    return s_recording;
+#else
+    return false;
+#endif
+}
+
+//******************************************************************************
+// MARK: Export
+//******************************************************************************
+
+void
+Trace::ExportChromeTrace(std::ostream& rStream)
+{
+    rStream << "{\"traceEvents\":[";
+
+#ifdef libcpptask_TRACING
+    static const std::string s_defaultName = "Task";
+
+    std::lock_guard<std::mutex> lockGuard(s_bufferMutex);
+
+    auto startTime = s_startTime.load();
+    bool first = true;
+
+    auto separate = [&rStream, &first](){
+        if (!first)
+        {
+            rStream << ',';
+        }
+
+        rStream << '\n';
+        first = false;
+    };
+
+    for (const auto& c_rBuffer : s_buffers)
+    {
+        auto count = c_rBuffer->m_count.load(std::memory_order_acquire);
+        auto begin = count > libcpptask_TRACE_BUFFER_CAPACITY ? count - libcpptask_TRACE_BUFFER_CAPACITY : 0;
+        auto tid = c_rBuffer->m_threadIndex;
+
+        separate();
+        rStream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << tid 
+                << ",\"args\":{\"name\":";
+        WriteJsonString(rStream, c_rBuffer->m_threadName);
+        rStream << "}}";
+
+        for (auto i = begin; i < count; ++i)
+        {
+            const auto& c_rEvent = c_rBuffer->m_events[i & (libcpptask_TRACE_BUFFER_CAPACITY - 1)];
+            const auto& c_rName = c_rEvent.c_pName ? *c_rEvent.c_pName : s_defaultName;
+
+            char timestamp[32];
+            std::snprintf(timestamp, sizeof(timestamp), "%.3f", 
+                          static_cast<double>(c_rEvent.m_timestamp - startTime) / 1000.0);
+
+            char id[32];
+            std::snprintf(id, sizeof(id), "\"%p\"", c_rEvent.c_pTask);
+
+            separate();
+            rStream << "{\"name\":";
+            WriteJsonString(rStream, c_rName);
+
+            // Waiting spans queued tasks across threads, running spans the
+            // thread executing the task
+            switch (c_rEvent.m_type)
+            {
+                case TraceEventType::ENQUEUE:
+                    rStream << ",\"cat\":\"queue\",\"ph\":\"b\",\"id\":" << id;
+                    break;
+                case TraceEventType::DEQUEUE:
+                    rStream << ",\"cat\":\"queue\",\"ph\":\"e\",\"id\":" << id;
+                    break;
+                case TraceEventType::START:
+                    rStream << ",\"cat\":\"task\",\"ph\":\"B\"";
+                    break;
+                case TraceEventType::FINISH:
+                    rStream << ",\"cat\":\"task\",\"ph\":\"E\"";
+                    break;
+            }
+
+            rStream << ",\"ts\":" << timestamp << ",\"pid\":1,\"tid\":" << tid
+                    << ",\"args\":{\"task\":" << id << "}}";
+        }
+    }
+#endif
+
+    rStream << "\n]}\n";
+}
+
+// Namespace
+}
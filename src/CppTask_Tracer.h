@@ -0,0 +1,89 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef libcpptask_CppTask_Tracer_h
+#define libcpptask_CppTask_Tracer_h
+
+// STL
+#include <string>
+
+// External
+
+// Project
+#include "../include/libcpptask/CppTask_Task.h"
+
+
+#ifdef libcpptask_TRACING
+    #define libcpptask_TRACE(type, pTaskThread) ::CppTask::Tracer::Record(type, pTaskThread)
+    #define libcpptask_TRACE_THREAD_NAME(c_rName) ::CppTask::Tracer::SetThreadName(c_rName)
+#else
+    #define libcpptask_TRACE(type, pTaskThread) ((void)0)
+    #define libcpptask_TRACE_THREAD_NAME(c_rName) ((void)0)
+#endif
+
+
+// Namespace
+namespace CppTask {
+
+/**
+ *  @brief The scheduler events recorded for a task thread.
+ */
+enum TraceEventType
+{
+    ENQUEUE = 0,
+    DEQUEUE = 1,
+    START = 2,
+    FINISH = 3
+};
+
+/**
+ *  @brief The tracer records scheduler events into a ring buffer owned by the
+ *         calling thread, writing never locks. Use the libcpptask_TRACE 
+ *         macros to record, they compile to nothing without tracing.
+ */
+class Tracer
+{
+public:
+
+    //**************************************************************************
+    // MARK: Record
+    //**************************************************************************
+
+    /**
+     *  @brief Record an event of a task thread if recording. This function is
+     *         thread-safe.
+     *
+     *  @param type The event type.
+     *  @param c_pTaskThread The task thread the event belongs to.
+     */
+    static void
+    Record(TraceEventType type, const TaskThread* c_pTaskThread) noexcept;
+
+    /**
+     *  @brief Name the calling thread in exported traces. This function is 
+     *         thread-safe.
+     *
+     *  @param c_rName The thread name.
+     */
+    static void
+    SetThreadName(const std::string& c_rName) noexcept;
+};
+
+// Namespace
+}
+
+#endif /* libcpptask_CppTask_Tracer_h */
@@ -0,0 +1,138 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// STL
+#include <atomic>
+#include <cstdint>
+
+// External
+
+// Project
+#include "../include/libcpptask/CppTask_WorkerLocal.h"
+#include "../include/libcpptask/CppTask_Exception.h"
+
+
+// Namespace
+namespace CppTask {
+
+//******************************************************************************
+// MARK: Slot Lease
+//******************************************************************************
+
+/**
+ *  @brief The occupied slots, a bit per slot. Constant initialized and never
+ *         destroyed, threads may exit during static destruction.
+ */
+static std::atomic<std::uint64_t> s_occupied[WorkerSlot::s_maxCount / 64] = {};
+
+/**
+ *  @brief Get the index of the lowest set bit.
+ *
+ *  @param value The value to check, not zero.
+ *
+ *  @returns The bit index.
+ */
+static inline size_t
+GetLowestBit(std::uint64_t value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<size_t>(__builtin_ctzll(value));
+#else
+    size_t bit = 0;
+
+    for (; (value & 1) == 0; value >>= 1)
+    {
+        ++bit;
+    }
+
+    return bit;
+#endif
+}
+
+/**
+ *  @brief The slot lease holds the slot of a thread while it runs.
+ */
+class SlotLease
+{
+public:
+
+    //**************************************************************************
+    // MARK: Constructor / Destructor
+    //**************************************************************************
+
+    /**
+     *  @brief Default constructor. Takes the lowest free slot.
+     */
+    SlotLease()
+    {
+        for (size_t i = 0; i < WorkerSlot::s_maxCount / 64; ++i)
+        {
+            auto occupied = s_occupied[i].load(std::memory_order_relaxed);
+
+            while (~occupied != 0)
+            {
+                auto bit = GetLowestBit(~occupied);
+
+                if (s_occupied[i].compare_exchange_weak(occupied, 
+                                                        occupied | (std::uint64_t(1) << bit), 
+                                                        std::memory_order_acquire, 
+                                                        std::memory_order_relaxed))
+                {
+                    m_index = i * 64 + bit;
+                    return;
+                }
+            }
+        }
+
+        throw Exception("No free worker slot!");
+    }
+
+    /**
+     *  @brief Copy constructor. Disabled for this class.
+     *
+     *  @param c_rSlotLease SlotLease class source.
+     */
+    SlotLease(const SlotLease& c_rSlotLease) = delete;
+
+    /**
+     *  @brief Default destructor. Gives the slot back.
+     */
+    ~SlotLease() noexcept
+    {
+        s_occupied[m_index / 64].fetch_and(~(std::uint64_t(1) << (m_index % 64)), std::memory_order_release);
+    }
+
+    //**************************************************************************
+    // MARK: Variables
+    //**************************************************************************
+
+    size_t m_index;
+};
+
+//******************************************************************************
+// MARK: Getters
+//******************************************************************************
+
+size_t
+WorkerSlot::GetCurrent()
+{
+    thread_local SlotLease s_lease;
+    return s_lease.m_index;
+}
+
+// Namespace
+}
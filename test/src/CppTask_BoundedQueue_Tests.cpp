@@ -0,0 +1,161 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// STL
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <memory>
+
+// External
+#include <gtest/gtest.h>
+
+// Project
+#include "../../src/CppTask_BoundedQueue.h"
+
+
+//******************************************************************************
+// MARK: Tests
+//******************************************************************************
+
+TEST(BoundedQueue, Construct_CapacityNotPowerOfTwo_Throws)
+{
+    ASSERT_ANY_THROW(CppTask::BoundedQueue<int> queue(3));
+    ASSERT_ANY_THROW(CppTask::BoundedQueue<int> queue(0));
+}
+
+TEST(BoundedQueue, TryPop_Empty_ReturnsFalse)
+{
+    CppTask::BoundedQueue<int> queue(4);
+    int value = 0;
+
+    ASSERT_FALSE(queue.TryPop(value));
+}
+
+TEST(BoundedQueue, TryPush_Full_ReturnsFalse)
+{
+    CppTask::BoundedQueue<int> queue(4);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(queue.TryPush(i));
+    }
+
+    int value = 4;
+
+    ASSERT_FALSE(queue.TryPush(value));
+    ASSERT_EQ(value, 4);
+}
+
+TEST(BoundedQueue, TryPop_Filled_ReturnsValuesInOrder)
+{
+    CppTask::BoundedQueue<int> queue(4);
+
+    // Wrap around a few times to cover the sequence handling
+    for (int round = 0; round < 3; ++round)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            int value = i;
+            ASSERT_TRUE(queue.TryPush(value));
+        }
+
+        for (int i = 0; i < 4; ++i)
+        {
+            int value = -1;
+            ASSERT_TRUE(queue.TryPop(value));
+            ASSERT_EQ(value, i);
+        }
+    }
+}
+
+TEST(BoundedQueue, TryPop_SharedPointer_ReleasesSlotReference)
+{
+    CppTask::BoundedQueue<std::shared_ptr<int>> queue(4);
+    auto pValue = std::make_shared<int>(32);
+    auto pCopy = pValue;
+
+    ASSERT_TRUE(queue.TryPush(pCopy));
+    ASSERT_EQ(pCopy, nullptr);
+
+    std::shared_ptr<int> pResult;
+
+    ASSERT_TRUE(queue.TryPop(pResult));
+    ASSERT_EQ(*pResult, 32);
+    ASSERT_EQ(pValue.use_count(), 2);
+}
+
+TEST(BoundedQueue, TryPushTryPop_ManyThreads_TransfersAllValues)
+{
+    CppTask::BoundedQueue<size_t> queue(64);
+    std::atomic<size_t> sum(0);
+    std::atomic<size_t> popCount(0);
+    std::vector<std::thread> threads;
+
+    const size_t c_threadCount = 4;
+    const size_t c_valueCount = 10000;
+
+    for (size_t i = 0; i < c_threadCount; ++i)
+    {
+        threads.emplace_back([&queue](){
+            for (size_t j = 1; j <= c_valueCount; ++j)
+            {
+                size_t value = j;
+
+                while (!queue.TryPush(value))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        threads.emplace_back([&](){
+            while (popCount < c_threadCount * c_valueCount)
+            {
+                size_t value = 0;
+
+                if (queue.TryPop(value))
+                {
+                    sum += value;
+                    popCount += 1;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& rThread : threads)
+    {
+        rThread.join();
+    }
+
+    ASSERT_EQ(sum, c_threadCount * (c_valueCount * (c_valueCount + 1) / 2));
+}
+
+//******************************************************************************
+// MARK: Main
+//******************************************************************************
+
+int
+main(int argc, char* argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
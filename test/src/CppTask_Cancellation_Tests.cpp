@@ -0,0 +1,94 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// STL
+#include <chrono>
+#include <thread>
+
+// External
+#include <gtest/gtest.h>
+
+// Project
+#include "../../include/libcpptask/CppTask_Cancellation.h"
+
+
+//******************************************************************************
+// MARK: Tests
+//******************************************************************************
+
+TEST(CancellationToken, Construct_Default_NotCancelled)
+{
+    CppTask::CancellationToken token;
+
+    ASSERT_TRUE(token.CanBeCancelled());
+    ASSERT_FALSE(token.IsCancelled());
+}
+
+TEST(CancellationToken, Cancel_Copy_CancelsAllCopies)
+{
+    CppTask::CancellationToken token;
+    CppTask::CancellationToken copy = token;
+
+    copy.Cancel();
+
+    ASSERT_TRUE(token.IsCancelled());
+    ASSERT_TRUE(copy.IsCancelled());
+}
+
+TEST(CancellationToken, Cancel_None_NeverCancelled)
+{
+    auto token = CppTask::CancellationToken::None();
+
+    token.Cancel();
+    token.CancelAt(CppTask::CancellationToken::Clock::now());
+
+    ASSERT_FALSE(token.CanBeCancelled());
+    ASSERT_FALSE(token.IsCancelled());
+}
+
+TEST(CancellationToken, CancelAt_PassedDeadline_Cancelled)
+{
+    CppTask::CancellationToken token;
+
+    token.CancelAt(CppTask::CancellationToken::Clock::now() - std::chrono::milliseconds(1));
+
+    ASSERT_TRUE(token.IsCancelled());
+}
+
+TEST(CancellationToken, CancelAfter_Duration_CancelledOncePassed)
+{
+    CppTask::CancellationToken token;
+
+    token.CancelAfter(std::chrono::milliseconds(20));
+
+    ASSERT_FALSE(token.IsCancelled());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(40));
+
+    ASSERT_TRUE(token.IsCancelled());
+}
+
+//******************************************************************************
+// MARK: Main
+//******************************************************************************
+
+int
+main(int argc, char* argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,252 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// STL
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <stdexcept>
+
+// External
+#include <gtest/gtest.h>
+
+// Project
+#include "../../include/libcpptask/CppTask_Coroutine.h"
+#include "../../include/libcpptask/CppTask_IO.h"
+
+
+//******************************************************************************
+// MARK: Helpers
+//******************************************************************************
+
+CppTask::Task<int>
+ReturnValue(int value)
+{
+    co_return value;
+}
+
+CppTask::Task<int>
+AddValues(int first, int second)
+{
+    int firstResult = co_await ReturnValue(first);
+    int secondResult = co_await ReturnValue(second);
+
+    co_return firstResult + secondResult;
+}
+
+CppTask::Task<int>
+ThrowValue(int value)
+{
+    throw std::runtime_error("Coroutine failed!");
+    co_return value;
+}
+
+CppTask::Task<int>
+AwaitThrown()
+{
+    co_return co_await ThrowValue(1);
+}
+
+CppTask::Task<void>
+CountAwaited(std::shared_ptr<CppTask::Task<int>> pTask, std::atomic<int>& rCount)
+{
+    rCount += co_await pTask;
+}
+
+#ifdef libcpptask_IO
+
+CppTask::Task<int>
+ReturnAfterTimer(int value)
+{
+    co_await CppTask::IO::Timer(std::chrono::milliseconds(1));
+    co_return value;
+}
+
+#endif
+
+//******************************************************************************
+// MARK: Tests
+//******************************************************************************
+
+TEST(Coroutine, Construct_CoroutineTask_IsLazy)
+{
+    auto task = ReturnValue(32);
+
+    ASSERT_EQ(task.GetState(), CppTask::TaskState::WAITING);
+}
+
+TEST(Coroutine, Run_CoroutineTask_ReturnsResult)
+{
+    auto task = ReturnValue(32);
+
+    task.Run();
+
+    ASSERT_EQ(task.GetState(), CppTask::TaskState::FINISHED);
+    ASSERT_EQ(task.GetResult(), 32);
+}
+
+TEST(Coroutine, RunAsync_AwaitNestedCoroutines_ReturnsResult)
+{
+    auto task = AddValues(30, 2);
+
+    task.RunAsync();
+
+    ASSERT_EQ(task.AwaitResult(), 32);
+}
+
+TEST(Coroutine, RunAsync_AwaitRunningTask_ResumesOnFinish)
+{
+    std::atomic<int> count(0);
+
+    auto pTask = std::make_shared<CppTask::Task<int>>([](){
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        return 32;
+    });
+
+    auto coroutine = CountAwaited(pTask, count);
+
+    pTask->RunAsync();
+    coroutine.RunAsync();
+    coroutine.Await();
+
+    ASSERT_EQ(count, 32);
+}
+
+TEST(Coroutine, RunAsync_TaskDroppedWhileSuspended_KeepsRunning)
+{
+    std::atomic<int> count(0);
+    std::atomic<bool> release(false);
+
+    auto pTask = std::make_shared<CppTask::Task<int>>([&release](){
+        while (!release)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return 32;
+    });
+
+    {
+        // Awaiting starts the task, which only runs once the coroutine is 
+        // suspended on it
+        auto coroutine = CountAwaited(pTask, count);
+        coroutine.RunAsync();
+
+        while (pTask->GetState() == CppTask::TaskState::WAITING)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    release = true;
+    pTask->Await();
+
+    while (count != 32)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    ASSERT_EQ(count, 32);
+}
+
+TEST(Coroutine, RunAsync_ManyCoroutinesAwaitOneTask_AllResume)
+{
+    std::atomic<int> count(0);
+    std::vector<CppTask::Task<void>> coroutines;
+
+    auto pTask = std::make_shared<CppTask::Task<int>>([](){
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        return 1;
+    });
+
+    // Start the task first, awaiting coroutines start it otherwise and a
+    // later manual start would race them
+    pTask->RunAsync();
+
+    for (size_t i = 0; i < 256; ++i)
+    {
+        coroutines.emplace_back(CountAwaited(pTask, count));
+        coroutines.back().RunAsync();
+    }
+
+    for (auto& rCoroutine : coroutines)
+    {
+        rCoroutine.Await();
+    }
+
+    ASSERT_EQ(count, 256);
+}
+
+TEST(Coroutine, Run_ThrowingCoroutine_FaultsTask)
+{
+    auto task = ThrowValue(1);
+
+    task.Run();
+
+    ASSERT_EQ(task.GetState(), CppTask::TaskState::FAULTED);
+    ASSERT_THROW(task.GetResult(), std::runtime_error);
+}
+
+TEST(Coroutine, CoAwait_ThrowingCoroutine_PropagatesException)
+{
+    auto task = AwaitThrown();
+
+    task.Run();
+
+    ASSERT_EQ(task.GetState(), CppTask::TaskState::FAULTED);
+    ASSERT_THROW(task.AwaitResult(), std::runtime_error);
+}
+
+TEST(Coroutine, Reset_FinishedCoroutineTask_Throws)
+{
+    auto task = ReturnValue(32);
+
+    task.Run();
+
+    ASSERT_THROW(task.Reset(), CppTask::Exception);
+    ASSERT_EQ(task.GetResult(), 32);
+}
+
+TEST(Coroutine, Destroy_NeverRunCoroutineTask_Success)
+{
+    auto task = ReturnValue(32);
+}
+
+#ifdef libcpptask_IO
+
+TEST(Coroutine, CoAwait_IOTimer_ResumesOnceExpired)
+{
+    auto task = ReturnAfterTimer(32);
+
+    task.RunAsync();
+
+    ASSERT_EQ(task.AwaitResult(), 32);
+}
+
+#endif
+
+//******************************************************************************
+// MARK: Main
+//******************************************************************************
+
+int
+main(int argc, char* argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
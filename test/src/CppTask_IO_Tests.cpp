@@ -0,0 +1,189 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+// STL
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <system_error>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+// External
+#include <gtest/gtest.h>
+
+// Project
+#include "../../include/libcpptask/CppTask_IO.h"
+#include "../../include/libcpptask/CppTask_Task.h"
+
+
+//******************************************************************************
+// MARK: Tests
+//******************************************************************************
+
+/**
+ *  @brief A pipe closing both ends once destroyed.
+ */
+struct Pipe
+{
+    Pipe()
+    {
+        if (::pipe(m_descriptors) != 0)
+        {
+            throw std::system_error(errno, std::system_category(), "pipe");
+        }
+    }
+
+    ~Pipe()
+    {
+        CloseWriter();
+        ::close(m_descriptors[0]);
+    }
+
+    void
+    CloseWriter()
+    {
+        if (m_descriptors[1] >= 0)
+        {
+            ::close(m_descriptors[1]);
+            m_descriptors[1] = -1;
+        }
+    }
+
+    int m_descriptors[2];
+};
+
+TEST(IO, IsAvailable_IOCompiledIn_ReturnsTrue)
+{
+    ASSERT_TRUE(CppTask::IO::IsAvailable());
+}
+
+TEST(IO, ReadAsync_Pipe_FinishesOnceWritten)
+{
+    Pipe pipe;
+    char buffer[16] = {};
+
+    auto task = CppTask::IO::ReadAsync(pipe.m_descriptors[0], buffer, sizeof(buffer));
+
+    ASSERT_FALSE(task.AwaitFor(std::chrono::milliseconds(10)));
+
+    ASSERT_EQ(::write(pipe.m_descriptors[1], "Hello", 5), 5);
+
+    ASSERT_EQ(task.AwaitResult(), 5);
+    ASSERT_EQ(std::string(buffer, 5), "Hello");
+}
+
+TEST(IO, ReadAsync_ClosedWriter_ReturnsZero)
+{
+    Pipe pipe;
+    char buffer[16] = {};
+
+    auto task = CppTask::IO::ReadAsync(pipe.m_descriptors[0], buffer, sizeof(buffer));
+    pipe.CloseWriter();
+
+    ASSERT_EQ(task.AwaitResult(), 0);
+}
+
+TEST(IO, ReadAsync_InvalidDescriptor_Faults)
+{
+    char buffer[16] = {};
+
+    auto task = CppTask::IO::ReadAsync(-1, buffer, sizeof(buffer));
+
+    ASSERT_THROW(task.AwaitResult(), std::system_error);
+    ASSERT_EQ(task.GetState(), CppTask::TaskState::FAULTED);
+}
+
+TEST(IO, ReadAsync_RegularFile_ReadsImmediately)
+{
+    auto pFile = std::tmpfile();
+    ASSERT_NE(pFile, nullptr);
+
+    ASSERT_EQ(::write(::fileno(pFile), "File", 4), 4);
+    ASSERT_EQ(::lseek(::fileno(pFile), 0, SEEK_SET), 0);
+
+    char buffer[16] = {};
+    auto task = CppTask::IO::ReadAsync(::fileno(pFile), buffer, sizeof(buffer));
+
+    ASSERT_EQ(task.GetState(), CppTask::TaskState::FINISHED);
+    ASSERT_EQ(task.GetResult(), 4);
+    ASSERT_EQ(std::string(buffer, 4), "File");
+
+    std::fclose(pFile);
+}
+
+TEST(IO, WriteAsync_Socket_ReadAndWriteConcurrently)
+{
+    int descriptors[2];
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, descriptors), 0);
+
+    char first[8] = {};
+    char second[8] = {};
+
+    // Both directions of one socket wait at the same time
+    auto read = CppTask::IO::ReadAsync(descriptors[0], first, sizeof(first));
+    auto write = CppTask::IO::WriteAsync(descriptors[0], "Ping", 4);
+
+    ASSERT_EQ(write.AwaitResult(), 4);
+    ASSERT_EQ(::read(descriptors[1], second, sizeof(second)), 4);
+    ASSERT_EQ(std::string(second, 4), "Ping");
+
+    ASSERT_EQ(::write(descriptors[1], "Pong", 4), 4);
+    ASSERT_EQ(read.AwaitResult(), 4);
+    ASSERT_EQ(std::string(first, 4), "Pong");
+
+    ::close(descriptors[0]);
+    ::close(descriptors[1]);
+}
+
+TEST(IO, Timer_Duration_FinishesAfterDuration)
+{
+    auto startTime = std::chrono::steady_clock::now();
+
+    auto task = CppTask::IO::Timer(std::chrono::milliseconds(20));
+    task.Await();
+
+    ASSERT_EQ(task.GetState(), CppTask::TaskState::FINISHED);
+    ASSERT_GE(std::chrono::steady_clock::now() - startTime, std::chrono::milliseconds(20));
+}
+
+TEST(IO, Timer_Continuation_RunsOnPool)
+{
+    std::atomic<bool> ran(false);
+
+    auto task = CppTask::IO::Timer(std::chrono::milliseconds(1));
+    auto pContinuation = task.Then([&ran](){
+        ran = true;
+    });
+
+    pContinuation->Await();
+
+    ASSERT_TRUE(ran);
+}
+
+//******************************************************************************
+// MARK: Main
+//******************************************************************************
+
+int
+main(int argc, char* argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,254 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+// STL
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+
+// External
+#include <gtest/gtest.h>
+
+// Project
+#include "../../include/libcpptask/CppTask_MoveOnlyFunction.h"
+#include "../../include/libcpptask/CppTask_TaskAllocator.h"
+
+
+//******************************************************************************
+// MARK: Helpers
+//******************************************************************************
+
+/**
+ *  @brief A memory resource counting the blocks handed out.
+ */
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+
+    std::atomic<size_t> m_allocatedCount { 0 };
+    std::atomic<size_t> m_deallocatedCount { 0 };
+
+private:
+
+    void*
+    do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        ++m_allocatedCount;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void
+    do_deallocate(void* pMemory, std::size_t bytes, std::size_t alignment) override
+    {
+        ++m_deallocatedCount;
+        std::pmr::new_delete_resource()->deallocate(pMemory, bytes, alignment);
+    }
+
+    bool
+    do_is_equal(const std::pmr::memory_resource& c_rOther) const noexcept override
+    {
+        return this == &c_rOther;
+    }
+};
+
+/**
+ *  @brief A callable counting its copies and moves.
+ */
+struct CountingCallable
+{
+    CountingCallable(size_t* pCopyCount, size_t* pMoveCount)
+    : m_pCopyCount(pCopyCount),
+      m_pMoveCount(pMoveCount)
+    {}
+
+    CountingCallable(const CountingCallable& c_rCallable)
+    : m_pCopyCount(c_rCallable.m_pCopyCount),
+      m_pMoveCount(c_rCallable.m_pMoveCount)
+    {
+        ++(*m_pCopyCount);
+    }
+
+    CountingCallable(CountingCallable&& rCallable) noexcept
+    : m_pCopyCount(rCallable.m_pCopyCount),
+      m_pMoveCount(rCallable.m_pMoveCount)
+    {
+        ++(*m_pMoveCount);
+    }
+
+    int
+    operator()() const
+    {
+        return 1;
+    }
+
+    size_t* m_pCopyCount;
+    size_t* m_pMoveCount;
+};
+
+int
+ReturnTwo()
+{
+    return 2;
+}
+
+//******************************************************************************
+// MARK: Tests
+//******************************************************************************
+
+TEST(MoveOnlyFunction, Construct_Default_IsEmpty)
+{
+    CppTask::MoveOnlyFunction<int()> function;
+
+    ASSERT_FALSE(function);
+    ASSERT_THROW(function(), std::bad_function_call);
+}
+
+TEST(MoveOnlyFunction, Construct_NullCallables_AreEmpty)
+{
+    int (*pFunction)() = nullptr;
+
+    ASSERT_FALSE(CppTask::MoveOnlyFunction<int()>(pFunction));
+    ASSERT_FALSE(CppTask::MoveOnlyFunction<int()>(std::function<int()>()));
+    ASSERT_FALSE(CppTask::MoveOnlyFunction<int()>(nullptr));
+}
+
+TEST(MoveOnlyFunction, Construct_FunctionPointer_Invokes)
+{
+    CppTask::MoveOnlyFunction<int()> function(&ReturnTwo);
+
+    ASSERT_TRUE(function);
+    ASSERT_EQ(function(), 2);
+}
+
+TEST(MoveOnlyFunction, Construct_UniquePtrCapture_Invokes)
+{
+    auto pValue = std::make_unique<int>(3);
+
+    CppTask::MoveOnlyFunction<int(int)> function([pValue = std::move(pValue)](int add){
+        return *pValue + add;
+    });
+
+    ASSERT_EQ(function(4), 7);
+}
+
+TEST(MoveOnlyFunction, Invoke_VoidSignatureValueCallable_DiscardsValue)
+{
+    int count = 0;
+    std::array<char, 128> padding {};
+
+    CppTask::MoveOnlyFunction<void()> inlineFunction([&count](){
+        return ++count;
+    });
+    CppTask::MoveOnlyFunction<void()> heapFunction([&count, padding](){
+        return ++count + padding[0];
+    });
+
+    inlineFunction();
+    heapFunction();
+
+    ASSERT_EQ(count, 2);
+}
+
+TEST(MoveOnlyFunction, Construct_MovedCallable_IsNotCopied)
+{
+    size_t copyCount = 0;
+    size_t moveCount = 0;
+
+    CppTask::MoveOnlyFunction<int()> function(CountingCallable(&copyCount, &moveCount));
+    CppTask::MoveOnlyFunction<int()> moved(std::move(function));
+
+    ASSERT_FALSE(function);
+    ASSERT_EQ(moved(), 1);
+    ASSERT_EQ(copyCount, 0);
+    ASSERT_EQ(moveCount, 2);
+}
+
+TEST(MoveOnlyFunction, Construct_SmallCallable_DoesNotAllocate)
+{
+    CountingResource resource;
+    CppTask::TaskAllocator::SetMemoryResource(&resource);
+
+    {
+        std::array<char, 32> buffer {};
+        CppTask::MoveOnlyFunction<size_t()> function([buffer](){
+            return buffer.size();
+        });
+
+        ASSERT_EQ(function(), 32);
+    }
+
+    CppTask::TaskAllocator::SetMemoryResource(nullptr);
+
+    ASSERT_EQ(resource.m_allocatedCount, 0);
+}
+
+TEST(MoveOnlyFunction, Construct_LargeCallable_AllocatesFromTaskResource)
+{
+    CountingResource resource;
+    CppTask::TaskAllocator::SetMemoryResource(&resource);
+
+    {
+        std::array<char, 256> buffer {};
+        CppTask::MoveOnlyFunction<size_t()> function([buffer](){
+            return buffer.size();
+        });
+
+        ASSERT_EQ(resource.m_allocatedCount, 1);
+
+        // Moving hands over the allocation
+        auto moved = std::move(function);
+
+        ASSERT_EQ(moved(), 256);
+        ASSERT_EQ(resource.m_allocatedCount, 1);
+    }
+
+    CppTask::TaskAllocator::SetMemoryResource(nullptr);
+
+    ASSERT_EQ(resource.m_deallocatedCount, 1);
+}
+
+TEST(MoveOnlyFunction, Assign_Moved_DestroysPrevious)
+{
+    auto pFirst = std::make_shared<int>(1);
+    auto pSecond = std::make_shared<int>(2);
+
+    CppTask::MoveOnlyFunction<int()> function([pFirst](){
+        return *pFirst;
+    });
+    CppTask::MoveOnlyFunction<int()> other([pSecond](){
+        return *pSecond;
+    });
+
+    ASSERT_EQ(pFirst.use_count(), 2);
+
+    function = std::move(other);
+
+    ASSERT_EQ(pFirst.use_count(), 1);
+    ASSERT_EQ(function(), 2);
+}
+
+//******************************************************************************
+// MARK: Main
+//******************************************************************************
+
+int
+main(int argc, char* argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
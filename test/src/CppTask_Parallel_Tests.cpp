@@ -0,0 +1,179 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// STL
+#include <atomic>
+#include <numeric>
+#include <string>
+#include <vector>
+
+// External
+#include <gtest/gtest.h>
+
+// Project
+#include "../../include/libcpptask/CppTask_Parallel.h"
+#include "../../include/libcpptask/CppTask_Task.h"
+
+
+//******************************************************************************
+// MARK: Tests
+//******************************************************************************
+
+TEST(Parallel, ParallelFor_Range_VisitsEveryIndexOnce)
+{
+    std::vector<std::atomic<int>> visits(10000);
+
+    CppTask::ParallelFor(0, 10000, [&visits](int i){
+        visits[i] += 1;
+    });
+
+    for (auto& rVisit : visits)
+    {
+        ASSERT_EQ(rVisit, 1);
+    }
+}
+
+TEST(Parallel, ParallelFor_EmptyRange_DoesNothing)
+{
+    std::atomic<int> count(0);
+
+    CppTask::ParallelFor(10, 10, [&count](int){
+        count += 1;
+    });
+
+    CppTask::ParallelFor(10, 0, [&count](int){
+        count += 1;
+    });
+
+    ASSERT_EQ(count, 0);
+}
+
+TEST(Parallel, ParallelFor_OffsetRangeWithGrainSize_VisitsEveryIndexOnce)
+{
+    std::atomic<long> sum(0);
+
+    CppTask::ParallelFor(100L, 1100L, [&sum](long i){
+        sum += i;
+    }, 64);
+
+    ASSERT_EQ(sum, (100L + 1099L) * 1000L / 2);
+}
+
+TEST(Parallel, ParallelFor_FunctionThrows_RethrowsAfterAllChunks)
+{
+    std::atomic<int> count(0);
+
+    ASSERT_ANY_THROW(CppTask::ParallelFor(0, 1000, [&count](int i){
+        count += 1;
+
+        if (i == 500)
+        {
+            throw CppTask::Exception("Failed!");
+        }
+    }));
+
+    ASSERT_GE(count, 1);
+}
+
+TEST(Parallel, ParallelFor_FromWithinTask_DoesNotDeadlock)
+{
+    CppTask::Task<int> task([](){
+        std::atomic<int> count(0);
+
+        CppTask::ParallelFor(0, 1000, [&count](int){
+            count += 1;
+        });
+
+        return count.load();
+    });
+
+    task.Run();
+
+    ASSERT_EQ(task.GetResult(), 1000);
+}
+
+TEST(Parallel, ParallelTransform_Range_TransformsEveryElement)
+{
+    std::vector<int> input(5000);
+    std::vector<std::string> output(input.size());
+
+    std::iota(input.begin(), input.end(), 0);
+
+    auto end = CppTask::ParallelTransform(input.begin(), input.end(), output.begin(), [](int value){
+        return std::to_string(value);
+    });
+
+    ASSERT_EQ(end, output.end());
+
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        ASSERT_EQ(output[i], std::to_string(i));
+    }
+}
+
+TEST(Parallel, ParallelReduce_Sum_ReturnsSum)
+{
+    std::vector<long> input(100000);
+
+    std::iota(input.begin(), input.end(), 1);
+
+    auto result = CppTask::ParallelReduce(input.begin(), input.end(), 0L, [](long first, long second){
+        return first + second;
+    });
+
+    ASSERT_EQ(result, 100000L * 100001L / 2);
+}
+
+TEST(Parallel, ParallelReduce_NonCommutative_KeepsOrder)
+{
+    std::vector<std::string> input;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        input.emplace_back(std::to_string(i % 10));
+    }
+
+    auto expected = std::accumulate(input.begin(), input.end(), std::string(">"));
+    auto result = CppTask::ParallelReduce(input.begin(), input.end(), std::string(">"), 
+                                          [](std::string first, const std::string& c_rSecond){
+        return first + c_rSecond;
+    });
+
+    ASSERT_EQ(result, expected);
+}
+
+TEST(Parallel, ParallelReduce_EmptyRange_ReturnsInit)
+{
+    std::vector<int> input;
+
+    auto result = CppTask::ParallelReduce(input.begin(), input.end(), 32, [](int first, int second){
+        return first + second;
+    });
+
+    ASSERT_EQ(result, 32);
+}
+
+//******************************************************************************
+// MARK: Main
+//******************************************************************************
+
+int
+main(int argc, char* argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,763 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// STL
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+    #include <pthread.h>
+    #include <sched.h>
+#endif
+
+// External
+#include <gtest/gtest.h>
+
+// Project
+#include "../../include/libcpptask/CppTask_Pool.h"
+#include "../../include/libcpptask/CppTask_Task.h"
+
+
+//******************************************************************************
+// MARK: Tests
+//******************************************************************************
+
+TEST(Pool, Default_ReturnsInstance_Success)
+{
+    auto& rPool = CppTask::Pool::Default();
+
+    ASSERT_GE(rPool.GetThreadCount(), 1);
+    ASSERT_EQ(&rPool, &CppTask::Pool::Default());
+}
+
+TEST(Pool, Construct_ThreadCount_CreatesThreads)
+{
+    CppTask::PoolOptions options;
+    options.m_threadCount = 3;
+
+    CppTask::Pool pool(options);
+
+    ASSERT_EQ(pool.GetThreadCount(), 3);
+}
+
+TEST(Pool, RunAsync_OnPool_RunsOnPoolThread)
+{
+    CppTask::PoolOptions options;
+    options.m_threadCount = 2;
+
+    CppTask::Pool pool(options);
+    std::thread::id callerId = std::this_thread::get_id();
+
+    CppTask::Task<std::thread::id> task([](){
+        return std::this_thread::get_id();
+    });
+
+    task.RunAsync(pool);
+
+    ASSERT_NE(task.AwaitResult(), callerId);
+}
+
+TEST(Pool, RunAsync_RerunOnPool_Throws)
+{
+    CppTask::Pool pool;
+
+    CppTask::Task<int> task([](){
+        return 1;
+    });
+
+    task.RunAsync(pool);
+    task.Await();
+
+    ASSERT_ANY_THROW(task.RunAsync(pool));
+    ASSERT_ANY_THROW(task.RunAsync());
+}
+
+#if defined(__linux__)
+TEST(Pool, RunAsync_ThreadName_NamesPoolThreads)
+{
+    CppTask::PoolOptions options;
+    options.m_threadCount = 1;
+    options.m_threadName = "Bulk";
+
+    CppTask::Pool pool(options);
+
+    CppTask::Task<std::string> task([](){
+        char name[16] = {};
+        pthread_getname_np(pthread_self(), name, sizeof(name));
+        return std::string(name);
+    });
+
+    task.RunAsync(pool);
+
+    ASSERT_EQ(task.AwaitResult(), "Bulk0");
+}
+#endif
+
+#if defined(__linux__)
+TEST(Pool, RunAsync_ThreadAffinity_RunsOnCpu)
+{
+    CppTask::PoolOptions options;
+    options.m_threadCount = 2;
+    options.m_threadAffinity = { { 0 } };
+
+    CppTask::Pool pool(options);
+
+    // Both threads reuse the single affinity entry
+    std::vector<CppTask::Task<int>> tasks;
+
+    for (size_t i = 0; i < 8; ++i)
+    {
+        tasks.emplace_back([](){
+            return sched_getcpu();
+        });
+        tasks.back().RunAsync(pool);
+    }
+
+    for (auto& rTask : tasks)
+    {
+        ASSERT_EQ(rTask.AwaitResult(), 0);
+    }
+}
+#endif
+
+TEST(Pool, RunAsync_NumaAware_RunsTasks)
+{
+    CppTask::PoolOptions options;
+    options.m_threadCount = 4;
+    options.m_numaAware = true;
+
+    CppTask::Pool pool(options);
+    std::atomic<size_t> runCount(0);
+    std::vector<CppTask::Task<void>> tasks;
+
+    for (size_t i = 0; i < 64; ++i)
+    {
+        tasks.emplace_back([&runCount](){
+            runCount += 1;
+        });
+        tasks.back().RunAsync(pool);
+    }
+
+    for (auto& rTask : tasks)
+    {
+        rTask.Await();
+    }
+
+    ASSERT_EQ(pool.GetThreadCount(), 4);
+    ASSERT_EQ(runCount, 64);
+}
+
+TEST(Pool, RunAsync_NestedTask_StaysOnPool)
+{
+    CppTask::PoolOptions options;
+    options.m_threadCount = 1;
+
+    CppTask::Pool pool(options);
+
+    auto pNestedTask = std::make_shared<CppTask::Task<std::thread::id>>([](){
+        return std::this_thread::get_id();
+    });
+
+    CppTask::Task<std::thread::id> task([pNestedTask](){
+        pNestedTask->RunAsync();
+        return std::this_thread::get_id();
+    });
+
+    task.RunAsync(pool);
+
+    // The pool has a single thread, the nested task has to run on it
+    ASSERT_EQ(pNestedTask->AwaitResult(), task.AwaitResult());
+}
+
+TEST(Pool, Then_ParentOnPool_ContinuationStaysOnPool)
+{
+    CppTask::PoolOptions options;
+    options.m_threadCount = 1;
+
+    CppTask::Pool pool(options);
+
+    CppTask::Task<std::thread::id> task([](){
+        return std::this_thread::get_id();
+    });
+
+    auto pContinuation = task.Then([](std::thread::id){
+        return std::this_thread::get_id();
+    });
+
+    task.RunAsync(pool);
+
+    ASSERT_EQ(pContinuation->AwaitResult(), task.AwaitResult());
+}
+
+TEST(Pool, RunAsync_Priority_RunsHighFirst)
+{
+    CppTask::PoolOptions options;
+    options.m_threadCount = 1;
+
+    CppTask::Pool pool(options);
+    std::promise<void> gate;
+    std::shared_future<void> gateFuture(gate.get_future());
+
+    // Block the single pool thread until everything is queued
+    CppTask::Task<void> gateTask([gateFuture](){
+        gateFuture.wait();
+    });
+
+    gateTask.RunAsync(pool);
+
+    std::mutex mutex;
+    std::vector<CppTask::TaskPriority> order;
+    std::vector<CppTask::Task<void>> tasks;
+
+    for (auto priority : { CppTask::TaskPriority::LOW, CppTask::TaskPriority::NORMAL, CppTask::TaskPriority::HIGH })
+    {
+        for (size_t i = 0; i < 3; ++i)
+        {
+            tasks.emplace_back([&mutex, &order, priority](){
+                std::lock_guard<std::mutex> lockGuard(mutex);
+                order.emplace_back(priority);
+            }, priority);
+            tasks.back().RunAsync(pool);
+        }
+    }
+
+    gate.set_value();
+
+    for (auto& rTask : tasks)
+    {
+        rTask.Await();
+    }
+
+    ASSERT_EQ(order, std::vector<CppTask::TaskPriority>({ 
+        CppTask::TaskPriority::HIGH, CppTask::TaskPriority::HIGH, CppTask::TaskPriority::HIGH,
+        CppTask::TaskPriority::NORMAL, CppTask::TaskPriority::NORMAL, CppTask::TaskPriority::NORMAL,
+        CppTask::TaskPriority::LOW, CppTask::TaskPriority::LOW, CppTask::TaskPriority::LOW }));
+}
+
+TEST(Pool, RunAsync_LowPriorityBehindHigh_NotStarved)
+{
+    CppTask::PoolOptions options;
+    options.m_threadCount = 1;
+
+    CppTask::Pool pool(options);
+    std::promise<void> gate;
+    std::shared_future<void> gateFuture(gate.get_future());
+
+    CppTask::Task<void> gateTask([gateFuture](){
+        gateFuture.wait();
+    });
+
+    gateTask.RunAsync(pool);
+
+    std::atomic<size_t> runCount(0);
+    size_t lowRunIndex = 0;
+
+    CppTask::Task<void> lowTask([&runCount, &lowRunIndex](){
+        lowRunIndex = runCount++;
+    });
+
+    lowTask.RunAsync(pool, CppTask::TaskPriority::LOW);
+
+    std::vector<CppTask::Task<void>> tasks;
+
+    for (size_t i = 0; i < 256; ++i)
+    {
+        tasks.emplace_back([&runCount](){
+            runCount += 1;
+        });
+        tasks.back().RunAsync(pool, CppTask::TaskPriority::HIGH);
+    }
+
+    gate.set_value();
+    lowTask.Await();
+
+    for (auto& rTask : tasks)
+    {
+        rTask.Await();
+    }
+
+    // Aging lets the low priority task run long before the high lane drains
+    ASSERT_LT(lowRunIndex, 128);
+}
+
+TEST(Pool, Then_Priority_InheritedByContinuation)
+{
+    CppTask::PoolOptions options;
+    options.m_threadCount = 1;
+
+    CppTask::Pool pool(options);
+    std::promise<void> gate;
+    std::shared_future<void> gateFuture(gate.get_future());
+
+    CppTask::Task<void> gateTask([gateFuture](){
+        gateFuture.wait();
+    });
+
+    gateTask.RunAsync(pool);
+
+    std::atomic<size_t> runCount(0);
+    size_t continuationRunIndex = 0;
+
+    CppTask::Task<void> task([](){}, CppTask::TaskPriority::HIGH);
+
+    // The continuation is enqueued from the pool thread once the task ran,
+    // together with the normal priority tasks queued in the meantime
+    auto pContinuation = task.Then([&runCount, &continuationRunIndex](){
+        continuationRunIndex = runCount++;
+    });
+
+    task.RunAsync(pool);
+
+    std::vector<CppTask::Task<void>> tasks;
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        tasks.emplace_back([&runCount](){
+            runCount += 1;
+        });
+        tasks.back().RunAsync(pool);
+    }
+
+    gate.set_value();
+    pContinuation->Await();
+
+    for (auto& rTask : tasks)
+    {
+        rTask.Await();
+    }
+
+    ASSERT_EQ(continuationRunIndex, 0);
+}
+
+TEST(Pool, RunAsync_IdleOptions_RunsTasks)
+{
+    // Parking immediately, and spinning long enough to never park between 
+    // the bursts below, both have to run every task
+    for (auto idleCount : { 0, 100000 })
+    {
+        CppTask::PoolOptions options;
+        options.m_threadCount = 2;
+        options.m_idleSpinCount = idleCount;
+        options.m_idleYieldCount = idleCount;
+
+        CppTask::Pool pool(options);
+        std::atomic<size_t> runCount(0);
+
+        for (size_t burst = 0; burst < 16; ++burst)
+        {
+            std::vector<CppTask::Task<void>> tasks;
+
+            for (size_t i = 0; i < 16; ++i)
+            {
+                tasks.emplace_back([&runCount](){
+                    runCount += 1;
+                });
+                tasks.back().RunAsync(pool);
+            }
+
+            for (auto& rTask : tasks)
+            {
+                rTask.Await();
+            }
+        }
+
+        ASSERT_EQ(runCount, 256);
+    }
+}
+
+TEST(Pool, Construct_ElasticMinAboveMax_Throws)
+{
+    CppTask::PoolOptions options;
+    options.m_minThreadCount = 4;
+    options.m_maxThreadCount = 2;
+
+    ASSERT_ANY_THROW(CppTask::Pool pool(options));
+}
+
+TEST(Pool, RunAsync_ElasticBlockingRegion_AddsThread)
+{
+    CppTask::PoolOptions options;
+    options.m_threadCount = 1;
+    options.m_maxThreadCount = 2;
+
+    CppTask::Pool pool(options);
+    std::promise<void> signal;
+    std::shared_future<void> signalFuture(signal.get_future());
+
+    // The first task blocks the only thread until the second one ran
+    CppTask::Task<void> blockingTask([signalFuture](){
+        CppTask::BlockingRegion blockingRegion;
+        signalFuture.wait();
+    });
+
+    CppTask::Task<void> signalTask([&signal](){
+        signal.set_value();
+    });
+
+    blockingTask.RunAsync(pool);
+    signalTask.RunAsync(pool);
+
+    blockingTask.Await();
+    signalTask.Await();
+
+    ASSERT_EQ(pool.GetThreadCount(), 2);
+}
+
+TEST(Pool, RunAsync_ElasticNestedAwait_Success)
+{
+    CppTask::PoolOptions options;
+    options.m_threadCount = 1;
+    options.m_maxThreadCount = 2;
+
+    CppTask::Pool pool(options);
+
+    // Awaiting the nested task blocks the only thread, the pool makes up 
+    // for it instead of deadlocking
+    CppTask::Task<int> task([](){
+        CppTask::Task<int> nestedTask([](){
+            return 1;
+        });
+
+        nestedTask.RunAsync();
+        
+        return nestedTask.AwaitResult() + 1;
+    });
+
+    task.RunAsync(pool);
+
+    ASSERT_EQ(task.AwaitResult(), 2);
+}
+
+TEST(Pool, RunAsync_ElasticStalledQueue_AddsThread)
+{
+    CppTask::PoolOptions options;
+    options.m_threadCount = 1;
+    options.m_maxThreadCount = 2;
+    options.m_queueDelay = std::chrono::milliseconds(5);
+
+    CppTask::Pool pool(options);
+    std::atomic<bool> signal(false);
+
+    // The first task keeps the only thread busy without telling the pool
+    CppTask::Task<void> busyTask([&signal](){
+        while (!signal)
+        {
+            std::this_thread::yield();
+        }
+    });
+
+    CppTask::Task<void> signalTask([&signal](){
+        signal = true;
+    });
+
+    busyTask.RunAsync(pool);
+    signalTask.RunAsync(pool);
+
+    busyTask.Await();
+    signalTask.Await();
+
+    ASSERT_EQ(pool.GetThreadCount(), 2);
+}
+
+TEST(Pool, RunAsync_ElasticIdle_RetiresThreads)
+{
+    CppTask::PoolOptions options;
+    options.m_threadCount = 3;
+    options.m_minThreadCount = 1;
+    options.m_maxThreadCount = 3;
+    options.m_idleTimeout = std::chrono::milliseconds(10);
+
+    CppTask::Pool pool(options);
+
+    ASSERT_EQ(pool.GetThreadCount(), 3);
+
+    for (size_t i = 0; i < 100 && pool.GetThreadCount() > 1; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    ASSERT_EQ(pool.GetThreadCount(), 1);
+
+    // The remaining thread still runs tasks
+    CppTask::Task<int> task([](){
+        return 1;
+    });
+
+    task.RunAsync(pool);
+
+    ASSERT_EQ(task.AwaitResult(), 1);
+}
+
+TEST(Pool, RunAsync_InlineThresholdReached_RunsOnCallingThread)
+{
+    CppTask::PoolOptions options;
+    options.m_threadCount = 1;
+    options.m_inlineThreshold = 2;
+
+    CppTask::Pool pool(options);
+    std::promise<void> gate;
+    std::shared_future<void> gateFuture(gate.get_future());
+
+    CppTask::Task<void> gateTask([gateFuture](){
+        gateFuture.wait();
+    });
+
+    gateTask.RunAsync(pool);
+
+    // Wait for the gate task to be taken, it no longer counts as queued
+    while (gateTask.GetState() == CppTask::TaskState::WAITING)
+    {
+        std::this_thread::yield();
+    }
+
+    std::vector<CppTask::Task<std::thread::id>> tasks;
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        tasks.emplace_back([](){
+            return std::this_thread::get_id();
+        });
+        tasks.back().RunAsync(pool);
+    }
+
+    // The third task found two queued tasks and ran right away
+    ASSERT_EQ(tasks[2].GetState(), CppTask::TaskState::FINISHED);
+    ASSERT_EQ(tasks[2].GetResult(), std::this_thread::get_id());
+
+    gate.set_value();
+
+    ASSERT_NE(tasks[0].AwaitResult(), std::this_thread::get_id());
+    ASSERT_NE(tasks[1].AwaitResult(), std::this_thread::get_id());
+}
+
+TEST(Pool, Then_LongChainOnSaturatedPool_QueuesContinuations)
+{
+    CppTask::PoolOptions options;
+    options.m_threadCount = 1;
+    options.m_inlineThreshold = 1;
+
+    CppTask::Pool pool(options);
+    CppTask::Task<void> filler([](){});
+
+    // The queued filler keeps the pool saturated while the chain runs, 
+    // continuations run inline would nest the whole chain on one stack
+    CppTask::Task<size_t> root([&filler, &pool](){
+        filler.RunAsync(pool);
+        return size_t(0);
+    });
+
+    auto pLast = root.Then([](size_t value){
+        return value + 1;
+    });
+
+    for (size_t i = 1; i < 10000; ++i)
+    {
+        pLast = pLast->Then([](size_t value){
+            return value + 1;
+        });
+    }
+
+    root.RunAsync(pool);
+
+    ASSERT_EQ(pLast->AwaitResult(), 10000);
+
+    filler.Await();
+}
+
+TEST(Pool, GetMetrics_AfterTasks_CountsTasks)
+{
+    CppTask::PoolOptions options;
+    options.m_threadCount = 2;
+
+    CppTask::Pool pool(options);
+    std::vector<CppTask::Task<void>> tasks;
+
+    for (size_t i = 0; i < 8; ++i)
+    {
+        tasks.emplace_back([i](){
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+            if (i == 0)
+            {
+                throw std::runtime_error("Task failed!");
+            }
+        });
+    }
+
+    CppTask::RunAllAsync(tasks, pool);
+
+    for (auto& rTask : tasks)
+    {
+        rTask.Await();
+    }
+
+    // Workers count a run after waking up the waiters
+    auto metrics = pool.GetMetrics();
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+    while (metrics.m_completedCount + metrics.m_failedCount < tasks.size() &&
+           std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::yield();
+        metrics = pool.GetMetrics();
+    }
+
+    ASSERT_EQ(metrics.m_queuedCount, 0);
+    ASSERT_EQ(metrics.m_submittedCount, 8);
+    ASSERT_EQ(metrics.m_completedCount, 7);
+    ASSERT_EQ(metrics.m_failedCount, 1);
+    ASSERT_EQ(metrics.m_cancelledCount, 0);
+    ASSERT_EQ(metrics.m_busyTimes.size(), 2);
+    ASSERT_GE(metrics.m_busyTimes[0] + metrics.m_busyTimes[1], std::chrono::milliseconds(8));
+    ASSERT_EQ(metrics.m_queueWaitHistogram.GetCount(), 8);
+    ASSERT_EQ(metrics.m_runTimeHistogram.GetCount(), 8);
+    ASSERT_GE(metrics.m_runTimeHistogram.GetPercentile(50), std::chrono::milliseconds(1));
+}
+
+TEST(Pool, GetMetrics_ResetRightAfterFault_CountsFailedRuns)
+{
+    CppTask::PoolOptions options;
+    options.m_threadCount = 1;
+
+    CppTask::Pool pool(options);
+    CppTask::Task<void> task([](){
+        throw std::runtime_error("Task failed!");
+    });
+
+    // Reset races the worker counting the run, the run still counts as the
+    // fault it ended in
+    for (size_t i = 0; i < 100; ++i)
+    {
+        task.RunAsync(pool);
+        task.Await();
+
+        while (true)
+        {
+            try
+            {
+                task.Reset();
+                break;
+            }
+            catch (const CppTask::Exception&)
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    auto metrics = pool.GetMetrics();
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+
+    while (metrics.m_completedCount + metrics.m_failedCount < 100 &&
+           std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::yield();
+        metrics = pool.GetMetrics();
+    }
+
+    ASSERT_EQ(metrics.m_failedCount, 100);
+    ASSERT_EQ(metrics.m_completedCount, 0);
+}
+
+TEST(Pool, GetMetrics_RunningTask_CountsBusyThread)
+{
+    CppTask::PoolOptions options;
+    options.m_threadCount = 2;
+
+    CppTask::Pool pool(options);
+    std::promise<void> gate;
+    std::shared_future<void> gateFuture(gate.get_future());
+
+    CppTask::Task<void> task([gateFuture](){
+        gateFuture.wait();
+    });
+
+    task.RunAsync(pool);
+
+    auto metrics = pool.GetMetrics();
+
+    while (metrics.m_busyThreadCount == 0)
+    {
+        std::this_thread::yield();
+        metrics = pool.GetMetrics();
+    }
+
+    ASSERT_EQ(metrics.m_busyThreadCount, 1);
+    ASSERT_EQ(metrics.m_idleThreadCount, 1);
+
+    gate.set_value();
+    task.Await();
+}
+
+TEST(Pool, LatencyHistogram_Percentile_ReturnsBucketBound)
+{
+    CppTask::LatencyHistogram histogram;
+
+    ASSERT_EQ(histogram.GetPercentile(50), std::chrono::microseconds(0));
+
+    histogram.m_buckets[0] = 90;
+    histogram.m_buckets[10] = 10;
+
+    ASSERT_EQ(histogram.GetCount(), 100);
+    ASSERT_EQ(histogram.GetPercentile(50), std::chrono::microseconds(1));
+    ASSERT_EQ(histogram.GetPercentile(99), std::chrono::microseconds(1024));
+}
+
+TEST(Pool, Destroy_AfterTasks_Success)
+{
+    std::atomic<size_t> runCount(0);
+
+    {
+        CppTask::PoolOptions options;
+        options.m_threadCount = 2;
+
+        CppTask::Pool pool(options);
+        std::vector<CppTask::Task<void>> tasks;
+
+        for (size_t i = 0; i < 64; ++i)
+        {
+            tasks.emplace_back([&runCount](){
+                runCount += 1;
+            });
+            tasks.back().RunAsync(pool);
+        }
+
+        for (auto& rTask : tasks)
+        {
+            rTask.Await();
+        }
+    }
+
+    ASSERT_EQ(runCount, 64);
+}
+
+//******************************************************************************
+// MARK: Main
+//******************************************************************************
+
+int
+main(int argc, char* argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
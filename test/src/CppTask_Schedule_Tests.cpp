@@ -0,0 +1,268 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+// STL
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+
+// External
+#include <gtest/gtest.h>
+
+// Project
+#include "../../include/libcpptask/CppTask_Schedule.h"
+#include "../../include/libcpptask/CppTask_Task.h"
+#include "../../include/libcpptask/CppTask_Pool.h"
+
+
+//******************************************************************************
+// MARK: Tests
+//******************************************************************************
+
+TEST(Schedule, RunAfter_Delay_RunsOncePassed)
+{
+    std::promise<std::chrono::steady_clock::time_point> promise;
+    auto future = promise.get_future();
+    auto start = std::chrono::steady_clock::now();
+
+    auto handle = CppTask::RunAfter(std::chrono::milliseconds(20), [&promise]() {
+        promise.set_value(std::chrono::steady_clock::now());
+    });
+
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    ASSERT_GE(future.get() - start, std::chrono::milliseconds(20));
+
+    // The handle no longer refers to a pending timer
+    ASSERT_FALSE(handle.IsPending());
+    ASSERT_FALSE(handle.Cancel());
+}
+
+TEST(Schedule, RunAt_PassedDeadline_RunsImmediately)
+{
+    std::promise<void> promise;
+    auto future = promise.get_future();
+
+    CppTask::RunAt(std::chrono::steady_clock::now() - std::chrono::seconds(1), [&promise]() {
+        promise.set_value();
+    });
+
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+}
+
+TEST(Schedule, Cancel_Pending_NeverRuns)
+{
+    std::atomic<bool> ran(false);
+
+    auto handle = CppTask::RunAfter(std::chrono::milliseconds(50), [&ran]() {
+        ran = true;
+    });
+
+    ASSERT_TRUE(handle.IsPending());
+    ASSERT_TRUE(handle.Cancel());
+    ASSERT_FALSE(handle.IsPending());
+    ASSERT_FALSE(handle.Cancel());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    ASSERT_FALSE(ran);
+}
+
+TEST(Schedule, Cancel_DefaultHandle_ReturnsFalse)
+{
+    CppTask::TimerHandle handle;
+
+    ASSERT_FALSE(handle.IsPending());
+    ASSERT_FALSE(handle.Cancel());
+}
+
+TEST(Schedule, RunEvery_Period_RunsUntilCancelled)
+{
+    std::atomic<int> count(0);
+
+    auto handle = CppTask::RunEvery(std::chrono::milliseconds(5), [&count]() {
+        ++count;
+    });
+
+    while (count < 3)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    ASSERT_TRUE(handle.IsPending());
+    ASSERT_TRUE(handle.Cancel());
+
+    // Nothing runs once cancelling returned, not even a run already queued
+    auto cancelledCount = count.load();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    ASSERT_EQ(count, cancelledCount);
+    ASSERT_FALSE(handle.IsPending());
+}
+
+TEST(Schedule, RunEvery_SlowRun_SkipsOverlapping)
+{
+    std::atomic<int> running(0);
+    std::atomic<int> overlaps(0);
+    std::atomic<int> count(0);
+
+    auto handle = CppTask::RunEvery(std::chrono::milliseconds(1), [&]() {
+        if (++running > 1)
+        {
+            ++overlaps;
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        ++count;
+        --running;
+    });
+
+    while (count < 3)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    handle.Cancel();
+
+    ASSERT_EQ(overlaps, 0);
+}
+
+TEST(Schedule, Cancel_WhileRunning_WaitsForRun)
+{
+    std::atomic<bool> started(false);
+    std::atomic<bool> finished(false);
+
+    auto handle = CppTask::RunAfter(std::chrono::milliseconds(1), [&started, &finished]() {
+        started = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        finished = true;
+    });
+
+    while (!started)
+    {
+        std::this_thread::yield();
+    }
+
+    handle.Cancel();
+
+    ASSERT_TRUE(finished);
+}
+
+TEST(Schedule, Cancel_FromWithinRun_DoesNotWait)
+{
+    std::promise<void> promise;
+    auto future = promise.get_future();
+    CppTask::TimerHandle handle;
+    std::mutex mutex;
+
+    std::unique_lock<std::mutex> uniqueLock(mutex);
+
+    handle = CppTask::RunEvery(std::chrono::milliseconds(1), [&]() {
+        {
+            std::lock_guard<std::mutex> lockGuard(mutex);
+            handle.Cancel();
+        }
+
+        // The test returns once signalled, nothing on its stack is touched
+        // afterwards
+        promise.set_value();
+    });
+
+    uniqueLock.unlock();
+
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    ASSERT_FALSE(handle.IsPending());
+}
+
+TEST(Schedule, RunEvery_ZeroPeriod_Throws)
+{
+    ASSERT_THROW(CppTask::RunEvery(std::chrono::nanoseconds::zero(), []() {}), CppTask::Exception);
+}
+
+TEST(Schedule, RunAfter_EmptyFunction_Throws)
+{
+    ASSERT_THROW(CppTask::RunAfter(std::chrono::milliseconds(1), CppTask::MoveOnlyFunction<void()>()), CppTask::Exception);
+}
+
+TEST(Task, RunAfter_Delay_RunsOncePassed)
+{
+    CppTask::Task<int> task([]() { return 42; });
+    auto start = std::chrono::steady_clock::now();
+
+    task.RunAfter(std::chrono::milliseconds(20));
+
+    ASSERT_EQ(task.GetState(), CppTask::TaskState::WAITING);
+
+    task.Await();
+
+    ASSERT_EQ(task.GetResult(), 42);
+    ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20));
+}
+
+TEST(Task, RunAt_Pool_RunsOnPool)
+{
+    CppTask::Pool pool;
+    CppTask::Task<std::thread::id> task([]() { return std::this_thread::get_id(); });
+
+    task.RunAt(std::chrono::steady_clock::now() + std::chrono::milliseconds(5), pool);
+    task.Await();
+
+    ASSERT_NE(task.GetResult(), std::this_thread::get_id());
+}
+
+TEST(Task, RunAt_PoolDestroyedBeforeDeadline_CancelsTask)
+{
+    std::atomic<bool> ran(false);
+    CppTask::Task<void> task([&ran]() { ran = true; });
+
+    {
+        CppTask::Pool pool;
+        task.RunAfter(std::chrono::milliseconds(20), pool);
+    }
+
+    // The timer never touches the destroyed pool, waiters are released
+    ASSERT_TRUE(task.AwaitFor(std::chrono::seconds(5)));
+    ASSERT_EQ(task.GetState(), CppTask::TaskState::CANCELLED);
+    ASSERT_FALSE(ran);
+}
+
+TEST(Task, RunAfter_RunBeforeDeadline_Throws)
+{
+    std::atomic<int> count(0);
+    CppTask::Task<void> task([&count]() { ++count; });
+
+    task.RunAfter(std::chrono::milliseconds(20));
+
+    // The timer holds the task until the deadline
+    ASSERT_THROW(task.Run(), CppTask::Exception);
+    ASSERT_THROW(task.RunAfter(std::chrono::milliseconds(1)), CppTask::Exception);
+
+    task.Await();
+
+    ASSERT_EQ(count, 1);
+}
+
+//******************************************************************************
+// MARK: Main
+//******************************************************************************
+
+int
+main(int argc, char* argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
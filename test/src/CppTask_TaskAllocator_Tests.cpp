@@ -0,0 +1,174 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// STL
+#include <atomic>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+// External
+#include <gtest/gtest.h>
+
+// Project
+#include "../../include/libcpptask/CppTask_Task.h"
+#include "../../include/libcpptask/CppTask_TaskAllocator.h"
+
+
+//******************************************************************************
+// MARK: Helpers
+//******************************************************************************
+
+/**
+ *  @brief A memory resource counting the blocks handed out.
+ */
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+
+    std::atomic<size_t> m_allocatedCount { 0 };
+    std::atomic<size_t> m_deallocatedCount { 0 };
+
+private:
+
+    void*
+    do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        ++m_allocatedCount;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void
+    do_deallocate(void* pMemory, std::size_t bytes, std::size_t alignment) override
+    {
+        ++m_deallocatedCount;
+        std::pmr::new_delete_resource()->deallocate(pMemory, bytes, alignment);
+    }
+
+    bool
+    do_is_equal(const std::pmr::memory_resource& c_rOther) const noexcept override
+    {
+        return this == &c_rOther;
+    }
+};
+
+//******************************************************************************
+// MARK: Tests
+//******************************************************************************
+
+TEST(TaskAllocator, GetMemoryResource_Default_ReturnsNewDelete)
+{
+    ASSERT_EQ(CppTask::TaskAllocator::GetMemoryResource(), std::pmr::new_delete_resource());
+}
+
+TEST(TaskAllocator, SetMemoryResource_CustomResource_AllocatesTasks)
+{
+    CountingResource resource;
+    CppTask::TaskAllocator::SetMemoryResource(&resource);
+
+    {
+        CppTask::Task<int> task([](){
+            return 1;
+        });
+
+        ASSERT_EQ(resource.m_allocatedCount, 1);
+
+        task.Run();
+
+        ASSERT_EQ(task.GetResult(), 1);
+    }
+
+    CppTask::TaskAllocator::SetMemoryResource(nullptr);
+
+    ASSERT_EQ(resource.m_deallocatedCount, 1);
+    ASSERT_EQ(CppTask::TaskAllocator::GetMemoryResource(), std::pmr::new_delete_resource());
+}
+
+TEST(TaskAllocator, SetMemoryResource_ReplacedWhileTaskExists_FreesToOrigin)
+{
+    CountingResource resource;
+    CppTask::TaskAllocator::SetMemoryResource(&resource);
+
+    auto pTask = std::make_unique<CppTask::Task<void>>([](){});
+
+    CppTask::TaskAllocator::SetMemoryResource(nullptr);
+    pTask.reset();
+
+    ASSERT_EQ(resource.m_allocatedCount, 1);
+    ASSERT_EQ(resource.m_deallocatedCount, 1);
+}
+
+TEST(TaskAllocator, ThreadCache_FreedBlock_IsReused)
+{
+    auto pResource = CppTask::TaskAllocator::ThreadCache();
+
+    auto pFirst = pResource->allocate(100);
+    pResource->deallocate(pFirst, 100);
+
+    // Any size of the same class reuses the block
+    auto pSecond = pResource->allocate(120);
+
+    ASSERT_EQ(pFirst, pSecond);
+
+    pResource->deallocate(pSecond, 120);
+
+    auto pLarge = pResource->allocate(4096);
+    pResource->deallocate(pLarge, 4096);
+}
+
+TEST(TaskAllocator, ThreadCache_TasksAcrossThreads_RunAll)
+{
+    CppTask::TaskAllocator::SetMemoryResource(CppTask::TaskAllocator::ThreadCache());
+
+    std::atomic<size_t> count(0);
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&count](){
+            for (size_t j = 0; j < 256; ++j)
+            {
+                CppTask::Task<size_t> task([j](){
+                    return j;
+                });
+
+                task.RunAsync();
+                count += task.AwaitResult() == j;
+            }
+        });
+    }
+
+    for (auto& rThread : threads)
+    {
+        rThread.join();
+    }
+
+    CppTask::TaskAllocator::SetMemoryResource(nullptr);
+
+    ASSERT_EQ(count, 1024);
+}
+
+//******************************************************************************
+// MARK: Main
+//******************************************************************************
+
+int
+main(int argc, char* argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,242 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// STL
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// External
+#include <gtest/gtest.h>
+
+// Project
+#include "../../include/libcpptask/CppTask_TaskGraph.h"
+
+
+//******************************************************************************
+// MARK: Tests
+//******************************************************************************
+
+TEST(TaskGraph, Construct_Empty_IsWaiting)
+{
+    CppTask::TaskGraph graph;
+
+    ASSERT_EQ(graph.GetNodeCount(), 0);
+    ASSERT_EQ(graph.GetState(), CppTask::TaskState::WAITING);
+}
+
+TEST(TaskGraph, Run_EmptyGraph_Finishes)
+{
+    CppTask::TaskGraph graph;
+
+    graph.Run();
+
+    ASSERT_EQ(graph.GetState(), CppTask::TaskState::FINISHED);
+}
+
+TEST(TaskGraph, AddEdge_InvalidNodes_Throws)
+{
+    CppTask::TaskGraph graph;
+    auto node = graph.AddNode([](){});
+
+    ASSERT_THROW(graph.AddEdge(node, node), CppTask::Exception);
+    ASSERT_THROW(graph.AddEdge(node, 1), CppTask::Exception);
+    ASSERT_THROW(graph.AddNode(nullptr), CppTask::Exception);
+}
+
+TEST(TaskGraph, RunAsync_Cycle_Throws)
+{
+    CppTask::TaskGraph graph;
+    auto first = graph.AddNode([](){});
+    auto second = graph.AddNode([](){});
+    auto third = graph.AddNode([](){});
+
+    graph.AddEdge(first, second);
+    graph.AddEdge(second, third);
+    graph.AddEdge(third, second);
+
+    ASSERT_THROW(graph.RunAsync(), CppTask::Exception);
+    ASSERT_EQ(graph.GetState(), CppTask::TaskState::WAITING);
+}
+
+TEST(TaskGraph, Run_FanOutFanIn_RunsInDependencyOrder)
+{
+    constexpr size_t c_transformCount = 8;
+
+    CppTask::TaskGraph graph;
+    std::vector<int> values(c_transformCount, 0);
+    int sum = 0;
+
+    auto parse = graph.AddNode([&values](){
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            values[i] = static_cast<int>(i);
+        }
+    });
+
+    auto merge = graph.AddNode([&values, &sum](){
+        sum = 0;
+
+        for (auto value : values)
+        {
+            sum += value;
+        }
+    });
+
+    for (size_t i = 0; i < c_transformCount; ++i)
+    {
+        auto transform = graph.AddNode([&values, i](){
+            values[i] *= 2;
+        });
+
+        graph.AddEdge(parse, transform);
+        graph.AddEdge(transform, merge);
+    }
+
+    graph.Run();
+
+    ASSERT_EQ(graph.GetState(), CppTask::TaskState::FINISHED);
+    ASSERT_EQ(sum, 56);
+}
+
+TEST(TaskGraph, Run_Repeatedly_RunsEveryNodeEachTime)
+{
+    CppTask::TaskGraph graph;
+    std::atomic<size_t> count(0);
+    std::vector<CppTask::TaskGraph::NodeId> nodes;
+
+    for (size_t i = 0; i < 16; ++i)
+    {
+        nodes.emplace_back(graph.AddNode([&count](){
+            ++count;
+        }));
+
+        if (i > 0)
+        {
+            graph.AddEdge(nodes[(i - 1) / 2], nodes[i]);
+        }
+    }
+
+    for (size_t i = 0; i < 100; ++i)
+    {
+        graph.Run();
+    }
+
+    ASSERT_EQ(count, 1600);
+}
+
+TEST(TaskGraph, RunAsync_WhileRunning_Throws)
+{
+    std::promise<void> gate;
+    std::shared_future<void> gateFuture(gate.get_future());
+
+    CppTask::TaskGraph graph;
+    graph.AddNode([gateFuture](){
+        gateFuture.wait();
+    });
+
+    graph.RunAsync();
+
+    ASSERT_EQ(graph.GetState(), CppTask::TaskState::RUNNING);
+    ASSERT_THROW(graph.RunAsync(), CppTask::Exception);
+    ASSERT_THROW(graph.AddNode([](){}), CppTask::Exception);
+    ASSERT_FALSE(graph.AwaitFor(std::chrono::milliseconds(10)));
+
+    gate.set_value();
+    graph.Await();
+
+    ASSERT_EQ(graph.GetState(), CppTask::TaskState::FINISHED);
+}
+
+TEST(TaskGraph, Run_ThrowingNode_FaultsAndSkipsSuccessors)
+{
+    CppTask::TaskGraph graph;
+    bool run = false;
+
+    auto first = graph.AddNode([](){
+        throw std::runtime_error("Node failed!");
+    });
+
+    auto second = graph.AddNode([&run](){
+        run = true;
+    });
+
+    graph.AddEdge(first, second);
+
+    ASSERT_THROW(graph.Run(), std::runtime_error);
+    ASSERT_EQ(graph.GetState(), CppTask::TaskState::FAULTED);
+    ASSERT_FALSE(run);
+
+    // A faulted graph can be run again
+    ASSERT_THROW(graph.Run(), std::runtime_error);
+}
+
+TEST(TaskGraph, RunAsync_OnPool_RunsOnPoolThreads)
+{
+    CppTask::PoolOptions options;
+    options.m_threadCount = 2;
+
+    CppTask::Pool pool(options);
+    CppTask::TaskGraph graph;
+    std::atomic<size_t> callerCount(0);
+    auto callerId = std::this_thread::get_id();
+
+    auto first = graph.AddNode([&callerCount, callerId](){
+        callerCount += std::this_thread::get_id() == callerId;
+    });
+
+    auto second = graph.AddNode([&callerCount, callerId](){
+        callerCount += std::this_thread::get_id() == callerId;
+    });
+
+    graph.AddEdge(first, second);
+    graph.RunAsync(pool);
+    graph.AwaitResult();
+
+    ASSERT_EQ(callerCount, 0);
+}
+
+TEST(TaskGraph, Destroy_WhileRunning_WaitsForRun)
+{
+    std::atomic<bool> done(false);
+
+    {
+        CppTask::TaskGraph graph;
+        graph.AddNode([&done](){
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            done = true;
+        });
+
+        graph.RunAsync();
+    }
+
+    ASSERT_TRUE(done);
+}
+
+//******************************************************************************
+// MARK: Main
+//******************************************************************************
+
+int
+main(int argc, char* argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,256 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+// STL
+#include <atomic>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// External
+#include <gtest/gtest.h>
+
+// Project
+#include "../../include/libcpptask/CppTask_TaskGroup.h"
+#include "../../include/libcpptask/CppTask_Task.h"
+#include "../../include/libcpptask/CppTask_Pool.h"
+
+
+//******************************************************************************
+// MARK: Helpers
+//******************************************************************************
+
+/**
+ *  @brief Sum up a range by splitting it in halves, every level awaiting its
+ *         halves through a task group.
+ *
+ *  @param begin The first value.
+ *  @param end The value after the last value.
+ *
+ *  @returns The sum of the range.
+ */
+static size_t
+NestedSum(size_t begin, size_t end)
+{
+    if (end - begin <= 4)
+    {
+        size_t sum = 0;
+
+        for (size_t i = begin; i < end; ++i)
+        {
+            sum += i;
+        }
+
+        return sum;
+    }
+
+    size_t middle = begin + (end - begin) / 2;
+    size_t first = 0;
+    size_t second = 0;
+
+    CppTask::TaskGroup group;
+    group.Spawn([&](){ first = NestedSum(begin, middle); });
+    group.Spawn([&](){ second = NestedSum(middle, end); });
+    group.Wait();
+
+    return first + second;
+}
+
+//******************************************************************************
+// MARK: Tests
+//******************************************************************************
+
+TEST(TaskGroup, Wait_NoChildren_Returns)
+{
+    CppTask::TaskGroup group;
+
+    group.Wait();
+}
+
+TEST(TaskGroup, Spawn_EmptyFunction_Throws)
+{
+    CppTask::TaskGroup group;
+
+    ASSERT_THROW(group.Spawn(nullptr), CppTask::Exception);
+}
+
+TEST(TaskGroup, Wait_SpawnedChildren_RunsAll)
+{
+    std::atomic<size_t> count(0);
+
+    CppTask::TaskGroup group;
+
+    for (size_t i = 0; i < 100; ++i)
+    {
+        group.Spawn([&count](){
+            ++count;
+        });
+    }
+
+    group.Wait();
+
+    ASSERT_EQ(count, 100);
+}
+
+TEST(TaskGroup, Wait_BusyPool_RunsChildrenOnCaller)
+{
+    CppTask::PoolOptions options;
+    options.m_threadCount = 1;
+
+    CppTask::Pool pool(options);
+
+    // Keep the only pool thread busy until the group is done
+    std::promise<void> gate;
+    auto future = gate.get_future().share();
+
+    CppTask::Task<void> blocker([future](){
+        future.wait();
+    });
+    blocker.RunAsync(pool);
+
+    std::atomic<size_t> callerCount(0);
+    auto callerId = std::this_thread::get_id();
+
+    CppTask::TaskGroup group(pool);
+
+    for (size_t i = 0; i < 8; ++i)
+    {
+        group.Spawn([&callerCount, callerId](){
+            callerCount += std::this_thread::get_id() == callerId;
+        });
+    }
+
+    group.Wait();
+    gate.set_value();
+    blocker.Await();
+
+    ASSERT_EQ(callerCount, 8);
+}
+
+TEST(TaskGroup, Wait_NestedDeeperThanPool_Finishes)
+{
+    CppTask::PoolOptions options;
+    options.m_threadCount = 2;
+
+    CppTask::Pool pool(options);
+
+    CppTask::Task<size_t> task([](){
+        return NestedSum(0, 1024);
+    });
+    task.RunAsync(pool);
+
+    ASSERT_EQ(task.AwaitResult(), 1023 * 1024 / 2);
+}
+
+TEST(TaskGroup, Spawn_FromChild_RunsNestedChild)
+{
+    std::atomic<size_t> count(0);
+
+    CppTask::TaskGroup group;
+
+    group.Spawn([&group, &count](){
+        group.Spawn([&count](){
+            ++count;
+        });
+
+        ++count;
+    });
+
+    group.Wait();
+
+    ASSERT_EQ(count, 2);
+}
+
+TEST(TaskGroup, Wait_ThrowingChild_Rethrows)
+{
+    CppTask::TaskGroup group;
+
+    group.Spawn([](){
+        throw std::runtime_error("Failed");
+    });
+
+    ASSERT_THROW(group.Wait(), std::runtime_error);
+
+    // The exception is consumed, the group can be used again
+    std::atomic<size_t> count(0);
+
+    group.Spawn([&count](){
+        ++count;
+    });
+
+    group.Wait();
+
+    ASSERT_EQ(count, 1);
+}
+
+TEST(TaskGroup, Wait_ThrowingChild_ReleasesSkippedCaptures)
+{
+    auto pResource = std::make_shared<int>(0);
+
+    for (size_t i = 0; i < 100; ++i)
+    {
+        CppTask::TaskGroup group;
+
+        group.Spawn([](){
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            throw std::runtime_error("Failed");
+        });
+
+        for (size_t j = 0; j < 16; ++j)
+        {
+            group.Spawn([pResource](){
+                ++*pResource;
+            });
+        }
+
+        ASSERT_THROW(group.Wait(), std::runtime_error);
+
+        // Skipped and run children alike let go of the resource by now
+        ASSERT_EQ(pResource.use_count(), 1);
+    }
+}
+
+TEST(TaskGroup, Destructor_PendingChildren_Waits)
+{
+    std::atomic<size_t> count(0);
+
+    {
+        CppTask::TaskGroup group;
+
+        for (size_t i = 0; i < 16; ++i)
+        {
+            group.Spawn([&count](){
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                ++count;
+            });
+        }
+    }
+
+    ASSERT_EQ(count, 16);
+}
+
+//******************************************************************************
+// MARK: Main
+//******************************************************************************
+
+int
+main(int argc, char* argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
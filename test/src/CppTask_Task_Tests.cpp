@@ -21,6 +21,11 @@
 #include <condition_variable>
 #include <atomic>
 #include <chrono>
+#include <string>
+#include <memory>
+#include <vector>
+#include <future>
+#include <stdexcept>
 
 // External
 #include <gtest/gtest.h>
@@ -81,6 +86,20 @@ TEST(Task, Construct_FunctionWithoutReturnValue_Success)
     });
 }
 
+TEST(Task, Run_ValueReturningFunctionWithoutReturnValue_DiscardsValue)
+{
+    int count = 0;
+
+    CppTask::Task<void> task([&count](){
+        return ++count;
+    });
+
+    task.Run();
+
+    ASSERT_EQ(task.GetState(), CppTask::TaskState::FINISHED);
+    ASSERT_EQ(count, 1);
+}
+
 TEST(Task, Copy_FunctionWithReturnValue_Success)
 {
     CppTask::Task<int> task([](){
@@ -116,6 +135,9 @@ TEST(Task, Destroy_RunningFunctionWithReturnValue_Success)
 
         std::this_thread::sleep_for(std::chrono::milliseconds(50));
     }
+
+    // Keep the pool free for the following timer based tests
+    task.Await();
 }
 
 TEST(Task, Destroy_RunningFunctionWithoutReturnValue_Success)
@@ -131,6 +153,9 @@ TEST(Task, Destroy_RunningFunctionWithoutReturnValue_Success)
 
         std::this_thread::sleep_for(std::chrono::milliseconds(50));
     }
+
+    // Keep the pool free for the following timer based tests
+    task.Await();
 }
 
 TEST(Task, CompletedTask_TaskWithReturnValue_ReturnsCompletedTaskWithValue)
@@ -142,6 +167,20 @@ TEST(Task, CompletedTask_TaskWithReturnValue_ReturnsCompletedTaskWithValue)
     ASSERT_EQ(pTask->GetResult(), 32);
 }
 
+TEST(Task, CompletedTask_ResetAndRun_ReturnsSameValue)
+{
+    auto pTask = CppTask::Task<std::string>::CompletedTask(std::string("Done"));
+
+    pTask->Reset();
+
+    ASSERT_EQ(pTask->GetState(), CppTask::TaskState::WAITING);
+
+    pTask->Run();
+
+    ASSERT_EQ(pTask->GetState(), CppTask::TaskState::FINISHED);
+    ASSERT_EQ(pTask->GetResult(), "Done");
+}
+
 TEST(Task, CompletedTask_TaskWithoutReturnValue_ReturnsCompletedTask)
 {
     auto pTask = CppTask::Task<void>::CompletedTask();
@@ -202,6 +241,35 @@ TEST(Task, Run_RerunFunctionWithoutReturnValue_SucceedsAndReturnsInstantly)
     ASSERT_EQ(task.GetState(), CppTask::TaskState::FINISHED);
 }
 
+TEST(Task, Run_Function_RunsOnCallingThread)
+{
+    CppTask::Task<std::thread::id> task([](){
+        return std::this_thread::get_id();
+    });
+
+    task.Run();
+
+    ASSERT_EQ(task.GetResult(), std::this_thread::get_id());
+}
+
+TEST(Task, Run_FromWithinTask_RunsOnPoolThread)
+{
+    CppTask::Task<bool> task([](){
+        CppTask::Task<std::thread::id> nestedTask([](){
+            return std::this_thread::get_id();
+        });
+
+        // Running inline does not need a second pool thread
+        nestedTask.Run();
+
+        return nestedTask.GetResult() == std::this_thread::get_id();
+    });
+
+    task.RunAsync();
+
+    ASSERT_TRUE(task.AwaitResult());
+}
+
 TEST(Task, RunAsync_FunctionWithReturnValue_SucceedsWithCorrectStates)
 {
     CppTask::Task<int> task([](){
@@ -295,6 +363,102 @@ TEST(Task, RunAsync_RunFromTwoSeparateThreads_OnlyRunsTaskOnce)
     ASSERT_EQ(runCount, 1);
 }
 
+TEST(Task, RunAsync_RacingThreads_ExactlyOneEnqueues)
+{
+    std::atomic<size_t> runCount(0);
+    std::atomic<size_t> throwCount(0);
+    std::atomic<bool> start(false);
+
+    CppTask::Task<void> task([&](){
+        runCount += 1;
+    });
+
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&](){
+            while (!start)
+            {
+                std::this_thread::yield();
+            }
+
+            try
+            {
+                task.RunAsync();
+            }
+            catch (const CppTask::Exception&)
+            {
+                throwCount += 1;
+            }
+        });
+    }
+
+    start = true;
+
+    for (auto& rThread : threads)
+    {
+        rThread.join();
+    }
+
+    task.Await();
+
+    ASSERT_EQ(runCount, 1);
+    ASSERT_EQ(throwCount, 3);
+}
+
+TEST(Task, Run_AfterRunAsync_Throws)
+{
+    std::atomic<size_t> runCount(0);
+
+    CppTask::Task<void> task([&](){
+        runCount += 1;
+    });
+
+    task.RunAsync();
+
+    // Queued or running elsewhere, never run twice
+    ASSERT_THROW(task.Run(), CppTask::Exception);
+
+    task.Await();
+
+    ASSERT_EQ(runCount, 1);
+}
+
+TEST(Task, Await_ManyWaiters_AllWake)
+{
+    std::promise<void> gate;
+    auto gateFuture = gate.get_future().share();
+
+    CppTask::Task<int> task([gateFuture](){
+        gateFuture.wait();
+        return 7;
+    });
+
+    task.RunAsync();
+
+    std::atomic<size_t> wokenCount(0);
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&](){
+            ASSERT_EQ(task.AwaitResult(), 7);
+            wokenCount += 1;
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    gate.set_value();
+
+    for (auto& rThread : threads)
+    {
+        rThread.join();
+    }
+
+    ASSERT_EQ(wokenCount, 4);
+}
+
 TEST(Task, RunAsync_RerunFunctionWithReturnValue_SucceedsWithCorrectStates)
 {
     CppTask::Task<int> task([](){
@@ -764,6 +928,250 @@ TEST(Task, GetResult_NotRunFunctionWithResult_Throws)
     ASSERT_ANY_THROW(task.GetResult());
 }
 
+TEST(Task, GetResultRef_Run_ReferencesStoredResult)
+{
+    CppTask::Task<std::vector<int>> task([](){
+        return std::vector<int>(1024, 32);
+    });
+
+    task.Run();
+
+    const auto& c_rFirstResult = task.GetResultRef();
+    const auto& c_rSecondResult = task.GetResultRef();
+
+    ASSERT_EQ(&c_rFirstResult, &c_rSecondResult);
+    ASSERT_EQ(c_rFirstResult.size(), 1024);
+    ASSERT_EQ(c_rFirstResult[0], 32);
+}
+
+TEST(Task, GetResultRef_NotRunFunctionWithResult_Throws)
+{
+    CppTask::Task<int> task([](){
+        return 1;
+    });
+
+    ASSERT_ANY_THROW(task.GetResultRef());
+}
+
+TEST(Task, TakeResult_Run_MovesResultOut)
+{
+    CppTask::Task<std::vector<int>> task([](){
+        return std::vector<int>(1024, 32);
+    });
+
+    task.Run();
+
+    const int* c_pData = task.GetResultRef().data();
+    auto result = std::move(task).TakeResult();
+
+    ASSERT_EQ(result.size(), 1024);
+    ASSERT_EQ(result.data(), c_pData);
+    ASSERT_ANY_THROW(task.GetResult());
+}
+
+TEST(Task, TakeResult_TriviallyCopyableResult_ReturnsResultOnce)
+{
+    CppTask::Task<TStruct> task([](){
+        return TStruct { 32 };
+    });
+
+    task.Run();
+
+    ASSERT_EQ(std::move(task).TakeResult().m_value, 32);
+    ASSERT_ANY_THROW(std::move(task).TakeResult());
+}
+
+TEST(Task, Then_RunAsync_RunsContinuationWithResult)
+{
+    CppTask::Task<int> task([](){
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        return 32;
+    });
+
+    auto pContinuation = task.Then([](int value){
+        return std::to_string(value);
+    });
+
+    ASSERT_EQ(pContinuation->GetState(), CppTask::TaskState::WAITING);
+
+    task.RunAsync();
+
+    ASSERT_EQ(pContinuation->AwaitResult(), "32");
+}
+
+TEST(Task, Then_FinishedTask_RunsContinuationImmediately)
+{
+    auto pTask = CppTask::Task<int>::CompletedTask(32);
+
+    auto pContinuation = pTask->Then([](int value){
+        return value + 1;
+    });
+
+    ASSERT_EQ(pContinuation->AwaitResult(), 33);
+}
+
+TEST(Task, Then_VoidTask_RunsContinuationChain)
+{
+    std::atomic<size_t> runCount(0);
+
+    CppTask::Task<void> task([&runCount](){
+        runCount += 1;
+    });
+
+    auto pFirstContinuation = task.Then([&runCount](){
+        runCount += 1;
+        return 2;
+    });
+
+    auto pSecondContinuation = pFirstContinuation->Then([&runCount](int value){
+        runCount += value;
+    });
+
+    task.RunAsync();
+    pSecondContinuation->Await();
+
+    ASSERT_EQ(runCount, 4);
+}
+
+TEST(Task, Then_RunContinuationManually_Throws)
+{
+    CppTask::Task<int> task([](){
+        return 1;
+    });
+
+    auto pContinuation = task.Then([](int value){
+        return value;
+    });
+
+    ASSERT_ANY_THROW(pContinuation->RunAsync());
+
+    task.Run();
+
+    ASSERT_EQ(pContinuation->AwaitResult(), 1);
+}
+
+TEST(Task, Then_ParentNeverRun_ReleasesContinuation)
+{
+    std::weak_ptr<int> pWeakCapture;
+
+    {
+        auto pCapture = std::make_shared<int>(32);
+        pWeakCapture = pCapture;
+
+        CppTask::Task<int> task([](){
+            return 1;
+        });
+
+        task.Then([pCapture](int value){
+            return *pCapture + value;
+        });
+    }
+
+    ASSERT_TRUE(pWeakCapture.expired());
+}
+
+TEST(Task, WhenAll_RunAsync_ReturnsResultsInOrder)
+{
+    std::vector<std::shared_ptr<CppTask::ITask<int>>> tasks;
+
+    for (int i = 0; i < 32; ++i)
+    {
+        tasks.emplace_back(std::make_shared<CppTask::Task<int>>([i](){
+            return i;
+        }));
+    }
+
+    auto pWhenAll = CppTask::WhenAll(tasks);
+
+    ASSERT_EQ(pWhenAll->GetState(), CppTask::TaskState::WAITING);
+
+    for (auto& rpTask : tasks)
+    {
+        rpTask->RunAsync();
+    }
+
+    auto results = pWhenAll->AwaitResult();
+
+    ASSERT_EQ(results.size(), 32);
+
+    for (int i = 0; i < 32; ++i)
+    {
+        ASSERT_EQ(results[i], i);
+    }
+}
+
+TEST(Task, WhenAll_VoidTasks_FinishesAfterAllTasks)
+{
+    std::atomic<size_t> runCount(0);
+    std::vector<std::shared_ptr<CppTask::ITask<void>>> tasks;
+
+    for (size_t i = 0; i < 32; ++i)
+    {
+        tasks.emplace_back(std::make_shared<CppTask::Task<void>>([&runCount](){
+            runCount += 1;
+        }));
+    }
+
+    auto pWhenAll = CppTask::WhenAll(tasks);
+
+    for (auto& rpTask : tasks)
+    {
+        rpTask->RunAsync();
+    }
+
+    pWhenAll->Await();
+
+    ASSERT_EQ(runCount, 32);
+}
+
+TEST(Task, WhenAll_NoTasks_ReturnsFinishedTask)
+{
+    auto pWhenAll = CppTask::WhenAll(std::vector<std::shared_ptr<CppTask::ITask<int>>>());
+
+    ASSERT_EQ(pWhenAll->GetState(), CppTask::TaskState::FINISHED);
+    ASSERT_TRUE(pWhenAll->GetResult().empty());
+}
+
+TEST(Task, WhenAll_RunManually_Throws)
+{
+    std::vector<std::shared_ptr<CppTask::ITask<int>>> tasks { 
+        std::make_shared<CppTask::Task<int>>([](){ return 1; }) 
+    };
+
+    auto pWhenAll = CppTask::WhenAll(tasks);
+
+    ASSERT_ANY_THROW(pWhenAll->RunAsync());
+
+    tasks[0]->Run();
+
+    ASSERT_EQ(pWhenAll->AwaitResult()[0], 1);
+}
+
+TEST(Task, WhenAny_RunAsync_ReturnsFirstFinishedIndex)
+{
+    std::vector<std::shared_ptr<CppTask::ITask<int>>> tasks { 
+        std::make_shared<CppTask::Task<int>>([](){ return 0; }),
+        std::make_shared<CppTask::Task<int>>([](){ return 1; })
+    };
+
+    auto pWhenAny = CppTask::WhenAny(tasks);
+
+    ASSERT_EQ(pWhenAny->GetState(), CppTask::TaskState::WAITING);
+
+    tasks[1]->Run();
+
+    ASSERT_EQ(pWhenAny->AwaitResult(), 1);
+
+    tasks[0]->Run();
+
+    ASSERT_EQ(pWhenAny->AwaitResult(), 1);
+}
+
+TEST(Task, WhenAny_NoTasks_Throws)
+{
+    ASSERT_ANY_THROW(CppTask::WhenAny(std::vector<std::shared_ptr<CppTask::ITask<int>>>()));
+}
+
 TEST(Task, Await_IsConstTask_Callable)
 {
     CppTask::Task<void> task([](){
@@ -836,6 +1244,579 @@ TEST(Task, GetState_IsConstTask_Callable)
     ASSERT_EQ(finalState, CppTask::TaskState::FINISHED);
 }
 
+TEST(Task, RunAllAsync_VectorOfTasks_RunsAllTasks)
+{
+    std::atomic<size_t> runCount(0);
+    std::vector<CppTask::Task<size_t>> tasks;
+
+    for (size_t i = 0; i < 1024; ++i)
+    {
+        tasks.emplace_back([&runCount, i](){
+            runCount += 1;
+            return i;
+        });
+    }
+
+    CppTask::RunAllAsync(tasks);
+
+    for (size_t i = 0; i < tasks.size(); ++i)
+    {
+        ASSERT_EQ(tasks[i].AwaitResult(), i);
+    }
+
+    ASSERT_EQ(runCount, 1024);
+}
+
+TEST(Task, RunAllAsync_SharedTasks_RunsAllTasks)
+{
+    std::vector<std::shared_ptr<CppTask::Task<int>>> tasks;
+
+    for (int i = 0; i < 64; ++i)
+    {
+        tasks.emplace_back(std::make_shared<CppTask::Task<int>>([i](){
+            return i * 2;
+        }));
+    }
+
+    CppTask::RunAllAsync(tasks);
+
+    for (int i = 0; i < 64; ++i)
+    {
+        ASSERT_EQ(tasks[i]->AwaitResult(), i * 2);
+    }
+}
+
+TEST(Task, RunAllAsync_ContainsRunTask_ThrowsAndRunsNone)
+{
+    std::atomic<size_t> runCount(0);
+    std::vector<CppTask::Task<void>> tasks;
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        tasks.emplace_back([&runCount](){
+            runCount += 1;
+        });
+    }
+
+    tasks.back().Run();
+
+    ASSERT_ANY_THROW(CppTask::RunAllAsync(tasks));
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        ASSERT_EQ(tasks[i].GetState(), CppTask::TaskState::WAITING);
+    }
+
+    ASSERT_EQ(runCount, 1);
+}
+
+TEST(Task, RunAllAsync_NullTask_Throws)
+{
+    std::vector<std::shared_ptr<CppTask::Task<void>>> tasks = { nullptr };
+
+    ASSERT_ANY_THROW(CppTask::RunAllAsync(tasks));
+}
+
+TEST(Task, RunAllAsync_FromWithinTask_RunsNestedTasks)
+{
+    auto pTasks = std::make_shared<std::vector<CppTask::Task<int>>>();
+
+    for (int i = 0; i < 32; ++i)
+    {
+        pTasks->emplace_back([i](){
+            return i;
+        });
+    }
+
+    CppTask::Task<void> task([pTasks](){
+        CppTask::RunAllAsync(*pTasks);
+    });
+
+    task.Run();
+
+    for (int i = 0; i < 32; ++i)
+    {
+        ASSERT_EQ((*pTasks)[i].AwaitResult(), i);
+    }
+}
+
+TEST(Task, Run_CancelledToken_SkipsFunction)
+{
+    bool run = false;
+    CppTask::CancellationToken token;
+
+    CppTask::Task<int> task([&run](){
+        run = true;
+        return 1;
+    }, token);
+
+    token.Cancel();
+    task.Run();
+
+    ASSERT_FALSE(run);
+    ASSERT_EQ(task.GetState(), CppTask::TaskState::CANCELLED);
+    ASSERT_ANY_THROW(task.GetResult());
+    ASSERT_ANY_THROW(task.Run());
+}
+
+TEST(Task, RunAsync_DeadlinePassed_CancelsTask)
+{
+    bool run = false;
+    CppTask::CancellationToken token;
+
+    token.CancelAt(CppTask::CancellationToken::Clock::now());
+
+    CppTask::Task<void> task([&run](){
+        run = true;
+    }, token);
+
+    task.RunAsync();
+    task.Await();
+
+    ASSERT_FALSE(run);
+    ASSERT_EQ(task.GetState(), CppTask::TaskState::CANCELLED);
+}
+
+TEST(Task, RunAsync_DeadlineAhead_RunsTask)
+{
+    CppTask::CancellationToken token;
+
+    token.CancelAfter(std::chrono::hours(1));
+
+    CppTask::Task<int> task([](){
+        return 1;
+    }, token, CppTask::TaskPriority::HIGH);
+
+    task.RunAsync();
+
+    ASSERT_EQ(task.AwaitResult(), 1);
+    ASSERT_EQ(task.GetState(), CppTask::TaskState::FINISHED);
+}
+
+TEST(Task, RunAsync_CancelWhileRunning_FunctionSeesToken)
+{
+    CppTask::CancellationToken token;
+    std::atomic<bool> started(false);
+
+    CppTask::Task<bool> task([token, &started](){
+        started = true;
+
+        while (!token.IsCancelled())
+        {
+            std::this_thread::yield();
+        }
+
+        return true;
+    }, token);
+
+    task.RunAsync();
+
+    while (!started)
+    {
+        std::this_thread::yield();
+    }
+
+    token.Cancel();
+
+    // Started tasks finish, the function decides what cancelling means
+    ASSERT_TRUE(task.AwaitResult());
+    ASSERT_EQ(task.GetState(), CppTask::TaskState::FINISHED);
+}
+
+TEST(Task, Then_CancelledParent_CancelsContinuation)
+{
+    CppTask::CancellationToken token;
+    bool run = false;
+
+    CppTask::Task<int> task([](){
+        return 1;
+    }, token);
+
+    auto pContinuation = task.Then([&run](int value){
+        run = true;
+        return value;
+    });
+
+    token.Cancel();
+    task.Run();
+    pContinuation->Await();
+
+    ASSERT_FALSE(run);
+    ASSERT_EQ(pContinuation->GetState(), CppTask::TaskState::CANCELLED);
+}
+
+TEST(Task, WhenAll_CancelledTask_CancelsCombinedTask)
+{
+    CppTask::CancellationToken token;
+
+    auto pFirst = std::make_shared<CppTask::Task<int>>([](){
+        return 1;
+    });
+
+    auto pSecond = std::make_shared<CppTask::Task<int>>([](){
+        return 2;
+    }, token);
+
+    auto pAll = CppTask::WhenAll<int>({ pFirst, pSecond });
+
+    token.Cancel();
+    pFirst->Run();
+    pSecond->Run();
+    pAll->Await();
+
+    ASSERT_EQ(pAll->GetState(), CppTask::TaskState::CANCELLED);
+    ASSERT_ANY_THROW(pAll->GetResult());
+}
+
+TEST(Task, Run_ThrowingFunction_FaultsTask)
+{
+    CppTask::Task<int> task([]() -> int {
+        throw std::runtime_error("Task failed!");
+    });
+
+    ASSERT_NO_THROW(task.Run());
+    ASSERT_EQ(task.GetState(), CppTask::TaskState::FAULTED);
+    ASSERT_TRUE(task.IsFinished());
+    ASSERT_THROW(task.GetResult(), std::runtime_error);
+    ASSERT_THROW(task.AwaitResult(), std::runtime_error);
+}
+
+TEST(Task, RunAsync_ThrowingVoidFunction_RethrowsOnAwaitResult)
+{
+    CppTask::Task<void> task([](){
+        throw std::runtime_error("Task failed!");
+    });
+
+    task.RunAsync();
+
+    ASSERT_THROW(task.AwaitResult(), std::runtime_error);
+    ASSERT_EQ(task.GetState(), CppTask::TaskState::FAULTED);
+}
+
+TEST(Task, Then_FaultedParent_FaultsContinuation)
+{
+    bool run = false;
+
+    CppTask::Task<int> task([]() -> int {
+        throw std::runtime_error("Task failed!");
+    });
+
+    auto pContinuation = task.Then([&run](int value){
+        run = true;
+        return value;
+    });
+
+    task.Run();
+    pContinuation->Await();
+
+    ASSERT_FALSE(run);
+    ASSERT_EQ(pContinuation->GetState(), CppTask::TaskState::FAULTED);
+    ASSERT_THROW(pContinuation->GetResult(), std::runtime_error);
+}
+
+TEST(Task, WhenAll_FaultedTask_FaultsCombinedTask)
+{
+    auto pFirst = std::make_shared<CppTask::Task<int>>([](){
+        return 1;
+    });
+
+    auto pSecond = std::make_shared<CppTask::Task<int>>([]() -> int {
+        throw std::runtime_error("Task failed!");
+    });
+
+    auto pAll = CppTask::WhenAll<int>({ pFirst, pSecond });
+
+    pFirst->Run();
+    pSecond->Run();
+    pAll->Await();
+
+    ASSERT_EQ(pAll->GetState(), CppTask::TaskState::FAULTED);
+    ASSERT_THROW(pAll->GetResult(), std::runtime_error);
+}
+
+TEST(Task, WhenAll_TwoFaultedTasks_RethrowsFirstException)
+{
+    auto pFirst = std::make_shared<CppTask::Task<int>>([]() -> int {
+        throw std::runtime_error("First failed!");
+    });
+
+    auto pSecond = std::make_shared<CppTask::Task<int>>([]() -> int {
+        throw std::logic_error("Second failed!");
+    });
+
+    auto pAll = CppTask::WhenAll<int>({ pFirst, pSecond });
+
+    pFirst->Run();
+    pSecond->Run();
+    pAll->Await();
+
+    // The second fault must not replace or clear the published exception
+    ASSERT_EQ(pAll->GetState(), CppTask::TaskState::FAULTED);
+    ASSERT_THROW(pAll->GetResult(), std::runtime_error);
+    ASSERT_THROW(pAll->GetResult(), std::runtime_error);
+}
+
+TEST(Task, Reset_FinishedTask_RunsAgain)
+{
+    int count = 0;
+
+    CppTask::Task<int> task([&count](){
+        return ++count;
+    });
+
+    for (int i = 1; i <= 100; ++i)
+    {
+        task.Run();
+
+        ASSERT_EQ(task.GetResult(), i);
+
+        task.Reset();
+
+        ASSERT_EQ(task.GetState(), CppTask::TaskState::WAITING);
+        ASSERT_THROW(task.GetResult(), CppTask::Exception);
+    }
+
+    task.RunAsync();
+
+    ASSERT_EQ(task.AwaitResult(), 101);
+}
+
+TEST(Task, Reset_FaultedTask_ClearsException)
+{
+    bool fail = true;
+
+    CppTask::Task<void> task([&fail](){
+        if (fail)
+        {
+            throw std::runtime_error("Task failed!");
+        }
+    });
+
+    task.Run();
+
+    ASSERT_THROW(task.GetResult(), std::runtime_error);
+
+    fail = false;
+    task.Reset();
+    task.Run();
+
+    ASSERT_EQ(task.GetState(), CppTask::TaskState::FINISHED);
+    ASSERT_NO_THROW(task.GetResult());
+}
+
+TEST(Task, Reset_RunningTask_Throws)
+{
+    std::promise<void> gate;
+    std::shared_future<void> gateFuture(gate.get_future());
+
+    CppTask::Task<void> task([gateFuture](){
+        gateFuture.wait();
+    });
+
+    task.RunAsync();
+
+    while (task.GetState() == CppTask::TaskState::WAITING)
+    {
+        std::this_thread::yield();
+    }
+
+    ASSERT_THROW(task.Reset(), CppTask::Exception);
+
+    gate.set_value();
+    task.Await();
+
+    ASSERT_NO_THROW(task.Reset());
+}
+
+TEST(Task, Reset_Continuation_Throws)
+{
+    CppTask::Task<int> task([](){
+        return 1;
+    });
+
+    auto pContinuation = task.Then([](int value){
+        return value;
+    });
+
+    task.Run();
+    pContinuation->Await();
+
+    ASSERT_THROW(pContinuation->Reset(), CppTask::Exception);
+    ASSERT_NO_THROW(task.Reset());
+}
+
+TEST(Task, Reset_RacingAwait_WaiterAlwaysWakes)
+{
+    std::atomic<bool> stop(false);
+
+    CppTask::Task<void> task([](){
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    });
+
+    task.Run();
+
+    // Resets race the waiter for the lock once a run is done, a lost wakeup
+    // leaves the waiter parked forever
+    std::thread resetThread([&task, &stop](){
+        while (!stop.load())
+        {
+            try
+            {
+                task.Reset();
+            }
+            catch (const CppTask::Exception&)
+            {
+                // Still running
+            }
+        }
+    });
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        while (true)
+        {
+            try
+            {
+                task.RunAsync();
+                break;
+            }
+            catch (const CppTask::Exception&)
+            {
+                // Not reset yet
+                std::this_thread::yield();
+            }
+        }
+
+        task.Await();
+    }
+
+    stop = true;
+    resetThread.join();
+}
+
+TEST(Task, AwaitFor_RunningTask_TimesOutThenSucceeds)
+{
+    std::promise<void> gate;
+    std::shared_future<void> gateFuture(gate.get_future());
+
+    CppTask::Task<int> task([gateFuture](){
+        gateFuture.wait();
+        return 1;
+    });
+
+    task.RunAsync();
+
+    ASSERT_FALSE(task.AwaitFor(std::chrono::milliseconds(10)));
+    ASSERT_FALSE(task.IsFinished());
+
+    gate.set_value();
+
+    ASSERT_TRUE(task.AwaitFor(std::chrono::seconds(10)));
+    ASSERT_TRUE(task.IsFinished());
+    ASSERT_EQ(task.GetResult(), 1);
+}
+
+TEST(Task, AwaitUntil_PassedDeadline_ReturnsState)
+{
+    CppTask::Task<void> task([](){});
+
+    auto now = std::chrono::steady_clock::now();
+
+    ASSERT_FALSE(task.AwaitUntil(now));
+
+    task.Run();
+
+    ASSERT_TRUE(task.AwaitUntil(now));
+}
+
+TEST(Task, IsFinished_CancelledTask_ReturnsTrue)
+{
+    CppTask::CancellationToken token;
+
+    CppTask::Task<void> task([](){}, token);
+
+    ASSERT_FALSE(task.IsFinished());
+
+    token.Cancel();
+    task.Run();
+
+    ASSERT_TRUE(task.IsFinished());
+}
+
+TEST(Task, Await_ManyWaiters_AllReturnAfterFinish)
+{
+    std::promise<void> gate;
+    std::shared_future<void> gateFuture(gate.get_future());
+    std::atomic<size_t> doneCount(0);
+
+    CppTask::Task<int> task([gateFuture](){
+        gateFuture.wait();
+        return 1;
+    });
+
+    std::vector<std::thread> waiters;
+
+    for (size_t i = 0; i < 8; ++i)
+    {
+        waiters.emplace_back([&task, &doneCount](){
+            task.Await();
+
+            // Await must never return before the task is done
+            if (task.IsFinished())
+            {
+                doneCount += 1;
+            }
+        });
+    }
+
+    task.RunAsync();
+    gate.set_value();
+
+    for (auto& rWaiter : waiters)
+    {
+        rWaiter.join();
+    }
+
+    ASSERT_EQ(doneCount, 8);
+}
+
+TEST(Task, Construct_MoveOnlyCapture_RunsTask)
+{
+    auto pValue = std::make_unique<int>(5);
+
+    CppTask::Task<int> task([pValue = std::move(pValue)](){
+        return *pValue;
+    });
+
+    task.RunAsync();
+
+    ASSERT_EQ(task.AwaitResult(), 5);
+}
+
+TEST(Task, Construct_MovedFunction_IsNotCopied)
+{
+    struct CopyCounter
+    {
+        explicit CopyCounter(size_t* pCount) : m_pCount(pCount) {}
+        CopyCounter(const CopyCounter& c_rCounter) : m_pCount(c_rCounter.m_pCount) { ++(*m_pCount); }
+        CopyCounter(CopyCounter&&) noexcept = default;
+
+        size_t* m_pCount;
+    };
+
+    size_t copyCount = 0;
+    CopyCounter counter(&copyCount);
+
+    CppTask::Task<size_t> task([counter = std::move(counter)](){
+        return *counter.m_pCount;
+    }, CppTask::TaskPriority::HIGH);
+
+    task.Run();
+
+    ASSERT_EQ(task.GetResult(), 0);
+    ASSERT_EQ(copyCount, 0);
+}
+
 //******************************************************************************
 // MARK: Main
 //******************************************************************************
@@ -16,11 +16,15 @@
  */
 
 // STL
+#include <atomic>
+#include <thread>
+#include <vector>
 
 // External
 #include <gtest/gtest.h>
 
 // Project
+#include "../../include/libcpptask/CppTask_Task.h"
 #include "../../src/CppTask_ThreadPool.h"
 
 
@@ -40,6 +44,75 @@ TEST(ThreadPool, Enqueue_InvalidTaskThread_Throws)
     ASSERT_ANY_THROW(rSingleton.Enqueue(nullptr));
 }
 
+TEST(ThreadPool, Enqueue_FromWorker_RunsNestedTasks)
+{
+    std::atomic<size_t> runCount(0);
+    std::vector<CppTask::Task<void>> nestedTasks;
+    CppTask::ThreadPool* pWorkerPool = nullptr;
+
+    for (size_t i = 0; i < 64; ++i)
+    {
+        nestedTasks.emplace_back([&runCount](){
+            runCount += 1;
+        });
+    }
+
+    // Nested tasks are enqueued from a pool thread, so they end up on the
+    // local deque of that worker and are stolen by the others
+    CppTask::Task<void> task([&nestedTasks, &pWorkerPool](){
+        pWorkerPool = CppTask::ThreadPool::CurrentWorkerPool();
+
+        for (auto& rNestedTask : nestedTasks)
+        {
+            rNestedTask.RunAsync();
+        }
+    });
+
+    task.RunAsync();
+    task.Await();
+
+    for (auto& rNestedTask : nestedTasks)
+    {
+        rNestedTask.Await();
+    }
+
+    ASSERT_EQ(pWorkerPool, &CppTask::ThreadPool::Singleton());
+    ASSERT_EQ(runCount, 64);
+}
+
+TEST(ThreadPool, Enqueue_ManyTasksFromExternalThreads_RunsAllTasks)
+{
+    std::atomic<size_t> runCount(0);
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([&runCount](){
+            std::vector<CppTask::Task<void>> tasks;
+
+            for (size_t j = 0; j < 256; ++j)
+            {
+                tasks.emplace_back([&runCount](){
+                    runCount += 1;
+                });
+                tasks.back().RunAsync();
+            }
+
+            for (auto& rTask : tasks)
+            {
+                rTask.Await();
+            }
+        });
+    }
+
+    for (auto& rThread : threads)
+    {
+        rThread.join();
+    }
+
+    ASSERT_EQ(runCount, 4 * 256);
+}
+
 //******************************************************************************
 // MARK: Main
 //******************************************************************************
@@ -0,0 +1,229 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+// STL
+#include <cstdint>
+#include <vector>
+
+// External
+#include <gtest/gtest.h>
+
+// Project
+#include "../../src/CppTask_TimerWheel.h"
+
+
+//******************************************************************************
+// MARK: Helpers
+//******************************************************************************
+
+/**
+ *  @brief Advance a wheel and collect the expired nodes.
+ *
+ *  @param rWheel The wheel to advance.
+ *  @param tick The tick to advance through.
+ *
+ *  @returns The expired nodes in expiry order.
+ */
+static std::vector<CppTask::TimerNode*>
+Advance(CppTask::TimerWheel& rWheel, std::uint64_t tick)
+{
+    std::vector<CppTask::TimerNode*> expired;
+
+    rWheel.Advance(tick, [&expired](CppTask::TimerNode* pNode) {
+        expired.push_back(pNode);
+    });
+
+    return expired;
+}
+
+//******************************************************************************
+// MARK: Tests
+//******************************************************************************
+
+TEST(TimerWheel, Expire)
+{
+    CppTask::TimerWheel wheel;
+    CppTask::TimerNode first;
+    CppTask::TimerNode second;
+
+    wheel.Insert(&first, 3);
+    wheel.Insert(&second, 5);
+
+    ASSERT_EQ(wheel.GetCount(), 2);
+    ASSERT_TRUE(first.IsLinked());
+
+    ASSERT_TRUE(Advance(wheel, 2).empty());
+
+    auto expired = Advance(wheel, 4);
+
+    ASSERT_EQ(expired.size(), 1);
+    ASSERT_EQ(expired[0], &first);
+    ASSERT_FALSE(first.IsLinked());
+
+    expired = Advance(wheel, 5);
+
+    ASSERT_EQ(expired.size(), 1);
+    ASSERT_EQ(expired[0], &second);
+    ASSERT_EQ(wheel.GetCount(), 0);
+    ASSERT_EQ(wheel.GetCurrentTick(), 6);
+}
+
+TEST(TimerWheel, ExpirePassed)
+{
+    CppTask::TimerWheel wheel;
+    CppTask::TimerNode node;
+
+    Advance(wheel, 100);
+    wheel.Insert(&node, 10);
+
+    auto expired = Advance(wheel, 101);
+
+    ASSERT_EQ(expired.size(), 1);
+    ASSERT_EQ(expired[0], &node);
+}
+
+TEST(TimerWheel, Cascade)
+{
+    CppTask::TimerWheel wheel;
+    std::vector<CppTask::TimerNode> nodes(5);
+    const std::uint64_t c_ticks[] = { 255, 256, 300, 70000, 20000000 };
+
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        wheel.Insert(&nodes[i], c_ticks[i]);
+    }
+
+    std::uint64_t tick = 0;
+
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        // Nothing may expire early while cascading across the levels
+        ASSERT_TRUE(Advance(wheel, c_ticks[i] - 1).empty());
+
+        auto expired = Advance(wheel, c_ticks[i]);
+
+        ASSERT_EQ(expired.size(), 1);
+        ASSERT_EQ(expired[0], &nodes[i]);
+
+        tick = c_ticks[i];
+    }
+
+    ASSERT_EQ(wheel.GetCount(), 0);
+    ASSERT_EQ(wheel.GetCurrentTick(), tick + 1);
+}
+
+TEST(TimerWheel, CascadeStepwise)
+{
+    CppTask::TimerWheel wheel;
+    CppTask::TimerNode node;
+
+    Advance(wheel, 1000);
+    wheel.Insert(&node, 1000 + 65600);
+
+    std::uint64_t tick = 1000;
+
+    // Step along the next ticks reported like a timer thread would
+    while (wheel.GetNextTick(tick))
+    {
+        auto expired = Advance(wheel, tick);
+
+        if (!expired.empty())
+        {
+            ASSERT_EQ(expired.size(), 1);
+            break;
+        }
+    }
+
+    ASSERT_EQ(tick, 1000 + 65600);
+    ASSERT_FALSE(node.IsLinked());
+}
+
+TEST(TimerWheel, Remove)
+{
+    CppTask::TimerWheel wheel;
+    CppTask::TimerNode first;
+    CppTask::TimerNode second;
+    CppTask::TimerNode third;
+
+    wheel.Insert(&first, 7);
+    wheel.Insert(&second, 7);
+    wheel.Insert(&third, 7);
+
+    ASSERT_TRUE(wheel.Remove(&second));
+    ASSERT_FALSE(wheel.Remove(&second));
+    ASSERT_EQ(wheel.GetCount(), 2);
+
+    auto expired = Advance(wheel, 7);
+
+    ASSERT_EQ(expired.size(), 2);
+    ASSERT_NE(expired[0], &second);
+    ASSERT_NE(expired[1], &second);
+    ASSERT_FALSE(wheel.Remove(&first));
+}
+
+TEST(TimerWheel, GetNextTick)
+{
+    CppTask::TimerWheel wheel;
+    CppTask::TimerNode node;
+    std::uint64_t tick = 0;
+
+    ASSERT_FALSE(wheel.GetNextTick(tick));
+
+    Advance(wheel, 9);
+    wheel.Insert(&node, 42);
+
+    ASSERT_TRUE(wheel.GetNextTick(tick));
+    ASSERT_EQ(tick, 42);
+
+    wheel.Remove(&node);
+    wheel.Insert(&node, 600);
+
+    // Only a cascade is due before
+    ASSERT_TRUE(wheel.GetNextTick(tick));
+    ASSERT_LE(tick, 600);
+    ASSERT_TRUE(Advance(wheel, tick).empty());
+}
+
+TEST(TimerWheel, Clear)
+{
+    CppTask::TimerWheel wheel;
+    std::vector<CppTask::TimerNode> nodes(3);
+    size_t removed = 0;
+
+    wheel.Insert(&nodes[0], 1);
+    wheel.Insert(&nodes[1], 1000);
+    wheel.Insert(&nodes[2], 1000000);
+
+    wheel.Clear([&removed](CppTask::TimerNode* pNode) {
+        ASSERT_FALSE(pNode->IsLinked());
+        ++removed;
+    });
+
+    ASSERT_EQ(removed, 3);
+    ASSERT_EQ(wheel.GetCount(), 0);
+    ASSERT_TRUE(Advance(wheel, 1000000).empty());
+}
+
+//******************************************************************************
+// MARK: Main
+//******************************************************************************
+
+int
+main(int argc, char* argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
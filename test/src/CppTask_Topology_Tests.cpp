@@ -0,0 +1,90 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// STL
+#include <thread>
+#include <vector>
+
+// External
+#include <gtest/gtest.h>
+
+// Project
+#include "../../src/CppTask_Topology.h"
+
+
+//******************************************************************************
+// MARK: Tests
+//******************************************************************************
+
+TEST(Topology, ParseCpuList_Ranges_Success)
+{
+    auto cpus = CppTask::Topology::ParseCpuList("0-3,8,10-11");
+
+    ASSERT_EQ(cpus, std::vector<size_t>({ 0, 1, 2, 3, 8, 10, 11 }));
+}
+
+TEST(Topology, ParseCpuList_Invalid_SkipsEntries)
+{
+    auto cpus = CppTask::Topology::ParseCpuList("1,x,-,4-5");
+
+    ASSERT_EQ(cpus, std::vector<size_t>({ 1, 4, 5 }));
+    ASSERT_TRUE(CppTask::Topology::ParseCpuList("").empty());
+}
+
+TEST(Topology, GetNodeCpus_HasNode_Success)
+{
+    auto nodes = CppTask::Topology::GetNodeCpus();
+
+    ASSERT_GE(nodes.size(), 1);
+
+    for (const auto& c_rCpus : nodes)
+    {
+        ASSERT_FALSE(c_rCpus.empty());
+    }
+}
+
+#if defined(__linux__)
+TEST(Topology, SetAffinity_SingleCpu_Success)
+{
+    std::thread thread([](){});
+
+    // The thread handle stays valid until joined, even if it already ended
+    bool result = CppTask::Topology::SetAffinity(thread, { 0 });
+    thread.join();
+
+    ASSERT_TRUE(result);
+}
+
+TEST(Topology, SetAffinity_NoValidCpu_Fails)
+{
+    std::thread thread([](){});
+
+    ASSERT_FALSE(CppTask::Topology::SetAffinity(thread, {}));
+    thread.join();
+}
+#endif
+
+//******************************************************************************
+// MARK: Main
+//******************************************************************************
+
+int
+main(int argc, char* argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
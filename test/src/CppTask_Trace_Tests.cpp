@@ -0,0 +1,146 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+// STL
+#include <sstream>
+#include <string>
+
+// External
+#include <gtest/gtest.h>
+
+// Project
+#include "../../include/libcpptask/CppTask_Task.h"
+#include "../../include/libcpptask/CppTask_Trace.h"
+
+
+//******************************************************************************
+// MARK: Tests
+//******************************************************************************
+
+TEST(Trace, SetName_NamedTask_ReturnsName)
+{
+    CppTask::Task<void> task([](){});
+
+    ASSERT_TRUE(task.GetName().empty());
+
+    task.SetName("Load \"Assets\"");
+
+    ASSERT_EQ(task.GetName(), "Load \"Assets\"");
+}
+
+TEST(Trace, ExportChromeTrace_NotRecorded_WritesEventList)
+{
+    std::ostringstream stream;
+
+    CppTask::Trace::ExportChromeTrace(stream);
+
+    ASSERT_EQ(stream.str().rfind("{\"traceEvents\":[", 0), 0);
+    ASSERT_NE(stream.str().find("]}"), std::string::npos);
+}
+
+#ifdef libcpptask_TRACING
+
+/**
+ *  @brief Count the occurrences of a string in a text.
+ */
+static size_t
+Count(const std::string& c_rText, const std::string& c_rPattern)
+{
+    size_t count = 0;
+
+    for (auto position = c_rText.find(c_rPattern); 
+         position != std::string::npos; 
+         position = c_rText.find(c_rPattern, position + 1))
+    {
+        ++count;
+    }
+
+    return count;
+}
+
+TEST(Trace, ExportChromeTrace_RecordedTasks_ContainsAllEvents)
+{
+    CppTask::Trace::Start();
+
+    ASSERT_TRUE(CppTask::Trace::IsRecording());
+
+    CppTask::Task<int> task([](){
+        return 1;
+    });
+
+    task.SetName("Load \"Assets\"");
+    task.RunAsync();
+    task.Await();
+
+    CppTask::Task<void> inlineTask([](){});
+    inlineTask.Run();
+
+    CppTask::Trace::Stop();
+
+    ASSERT_FALSE(CppTask::Trace::IsRecording());
+
+    std::ostringstream stream;
+    CppTask::Trace::ExportChromeTrace(stream);
+    auto trace = stream.str();
+
+    // The worker records the finish after waking up waiters, it may miss the
+    // end of the recording
+    ASSERT_GE(Count(trace, "\"name\":\"Load \\\"Assets\\\"\""), 3);
+    ASSERT_EQ(Count(trace, "\"ph\":\"b\""), 1);
+    ASSERT_EQ(Count(trace, "\"ph\":\"e\""), 1);
+    ASSERT_EQ(Count(trace, "\"ph\":\"B\""), 2);
+    ASSERT_GE(Count(trace, "\"ph\":\"E\""), 1);
+    ASSERT_NE(trace.find("\"name\":\"Worker 0\""), std::string::npos);
+}
+
+TEST(Trace, Start_NewRecording_DiscardsOldEvents)
+{
+    CppTask::Trace::Start();
+
+    CppTask::Task<void> task([](){});
+    task.Run();
+
+    CppTask::Trace::Start();
+    CppTask::Trace::Stop();
+
+    std::ostringstream stream;
+    CppTask::Trace::ExportChromeTrace(stream);
+
+    ASSERT_EQ(Count(stream.str(), "\"ph\":\"B\""), 0);
+}
+
+#else
+
+TEST(Trace, Start_TracingCompiledOut_Throws)
+{
+    ASSERT_FALSE(CppTask::Trace::IsAvailable());
+    ASSERT_THROW(CppTask::Trace::Start(), CppTask::Exception);
+    ASSERT_FALSE(CppTask::Trace::IsRecording());
+}
+
+#endif
+
+//******************************************************************************
+// MARK: Main
+//******************************************************************************
+
+int
+main(int argc, char* argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,169 @@
+/**
+ *  Copyright (C) 2025, BroerJe.
+ *  https://github.com/BroerJe
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+// STL
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// External
+#include <gtest/gtest.h>
+
+// Project
+#include "../../include/libcpptask/CppTask_WorkerLocal.h"
+#include "../../include/libcpptask/CppTask_Parallel.h"
+#include "../../include/libcpptask/CppTask_Task.h"
+#include "../../include/libcpptask/CppTask_Pool.h"
+
+
+//******************************************************************************
+// MARK: Tests
+//******************************************************************************
+
+TEST(WorkerSlot, GetCurrent_Threads_Unique)
+{
+    auto slot = CppTask::WorkerSlot::GetCurrent();
+    size_t otherSlot = slot;
+
+    std::thread thread([&otherSlot]() {
+        otherSlot = CppTask::WorkerSlot::GetCurrent();
+    });
+    thread.join();
+
+    ASSERT_EQ(CppTask::WorkerSlot::GetCurrent(), slot);
+    ASSERT_NE(otherSlot, slot);
+    ASSERT_LT(otherSlot, CppTask::WorkerSlot::s_maxCount);
+}
+
+TEST(WorkerLocal, Get_SameThread_SameInstance)
+{
+    CppTask::WorkerLocal<std::vector<int>> local;
+
+    local.Get().push_back(1);
+    local.Get().push_back(2);
+
+    ASSERT_EQ(local.Get().size(), 2);
+}
+
+TEST(WorkerLocal, Get_OtherThread_OtherInstance)
+{
+    CppTask::WorkerLocal<int> local;
+    int* pOther = nullptr;
+
+    local.Get() = 1;
+
+    std::thread thread([&]() {
+        pOther = &local.Get();
+        *pOther = 2;
+    });
+    thread.join();
+
+    ASSERT_NE(pOther, &local.Get());
+    ASSERT_EQ(local.Get(), 1);
+}
+
+TEST(WorkerLocal, Get_Instances_OwnCacheLines)
+{
+    CppTask::WorkerLocal<char> local;
+    std::uintptr_t other = 0;
+
+    std::thread thread([&]() {
+        other = reinterpret_cast<std::uintptr_t>(&local.Get());
+    });
+    thread.join();
+
+    auto address = reinterpret_cast<std::uintptr_t>(&local.Get());
+
+    ASSERT_EQ(address % 64, 0);
+    ASSERT_EQ(other % 64, 0);
+}
+
+TEST(WorkerLocal, Get_Factory_BuildsLazilyOncePerWorker)
+{
+    std::atomic<int> buildCount(0);
+    CppTask::WorkerLocal<std::unique_ptr<int>> local([&buildCount]() {
+        ++buildCount;
+        return std::make_unique<int>(7);
+    });
+
+    ASSERT_EQ(buildCount, 0);
+    ASSERT_EQ(*local.Get(), 7);
+    ASSERT_EQ(*local.Get(), 7);
+    ASSERT_EQ(buildCount, 1);
+}
+
+TEST(WorkerLocal, Get_FactoryNoDefaultConstructor_BuildsInstance)
+{
+    struct Buffer
+    {
+        explicit Buffer(size_t size)
+        : m_data(size)
+        {}
+
+        std::vector<int> m_data;
+    };
+
+    CppTask::WorkerLocal<Buffer> local([]() {
+        return Buffer(16);
+    });
+
+    ASSERT_EQ(local.Get().m_data.size(), 16);
+}
+
+TEST(WorkerLocal, ForEach_PoolWorkers_CombinesPartialResults)
+{
+    CppTask::WorkerLocal<size_t> local;
+
+    CppTask::ParallelFor(size_t(0), size_t(1000), [&local](size_t i) {
+        local.Get() += i;
+    });
+
+    size_t sum = 0;
+    size_t count = 0;
+
+    local.ForEach([&](size_t partial) {
+        sum += partial;
+        ++count;
+    });
+
+    ASSERT_EQ(sum, 999 * 1000 / 2);
+    ASSERT_GE(count, 1);
+}
+
+TEST(Pool, GetCurrentWorkerIndex_PoolThread_BelowThreadCount)
+{
+    CppTask::Pool pool;
+    CppTask::Task<size_t> task([]() { return CppTask::Pool::GetCurrentWorkerIndex(); });
+
+    task.RunAsync(pool);
+    task.Await();
+
+    ASSERT_LT(task.GetResult(), pool.GetThreadCount());
+    ASSERT_EQ(CppTask::Pool::GetCurrentWorkerIndex(), CppTask::Pool::s_noWorkerIndex);
+}
+
+//******************************************************************************
+// MARK: Main
+//******************************************************************************
+
+int
+main(int argc, char* argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}